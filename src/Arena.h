@@ -0,0 +1,89 @@
+/**@file Arena.h
+ *
+ * @brief Stack allocator of ints used by the vertex cover recursion.
+ *
+ * @details Every worker owns one arena (@see VertexCover::arena). The nodes of
+ * the recursion allocate their graphs and their scratch data on top of the
+ * arena and release everything they allocated when they return, so the memory
+ * is reused by the following nodes instead of going through malloc and free.
+ *
+ * The storage is a single buffer that grows when needed. Since growing moves
+ * the buffer, the allocations are identified by their offsets and pointers
+ * obtained through Arena::at are only valid until the next allocation.
+ *
+ * @author Jose L. Walteros
+ *
+ * @version   1.0
+ * @date      June 2018
+ *
+ * Copyright (C) 2018 Jose L. Walteros. All rights reserved.
+ *
+ *---+----+----+----+----+----+----+----+----+----+----+----+----+----+----+----*/
+#ifndef _ARENA_H_
+#define _ARENA_H_
+
+#include <algorithm>
+#include <vector>
+
+class Arena
+{
+public:
+    std::vector<int> buffer; /**< Storage */
+    int top = 0; /**< First free position of the buffer */
+
+    /**
+     * Allocates count ints.
+     *
+     * @returns the offset of the first one.
+     */
+    inline int allocate(
+        int count)
+    {
+        int offset = top;
+        top += count;
+
+        if (buffer.size() < (size_t)top)
+        {
+            buffer.resize(std::max((size_t)top, 2 * buffer.size()));
+        }
+        return offset;
+    }
+
+    /**
+     * Allocates count ints set to 0.
+     */
+    inline int allocateZeros(
+        int count)
+    {
+        int offset = allocate(count);
+        std::fill(buffer.begin() + offset, buffer.begin() + top, 0);
+        return offset;
+    }
+
+    /**
+     * Address of the int at the given offset.
+     */
+    inline int *at(
+        int offset)
+    {
+        return buffer.data() + offset;
+    }
+
+    /**
+     * Current top of the arena, to be passed to Arena::release.
+     */
+    inline int mark() const
+    {
+        return top;
+    }
+
+    /**
+     * Releases everything allocated after mark was taken.
+     */
+    inline void release(
+        int mark)
+    {
+        top = mark;
+    }
+};
+#endif // _ARENA_H_
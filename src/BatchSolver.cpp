@@ -0,0 +1,175 @@
+/**@file BatchSolver.cpp
+ *
+ * @brief Finds the maximum cliques of many graphs in a single process.
+ *
+ * @author Jose L. Walteros
+ *
+ * @version   1.0
+ * @date      June 2018
+ *
+ * Copyright (C) 2018 Jose L. Walteros. All rights reserved.
+ *
+ *---+----+----+----+----+----+----+----+----+----+----+----+----+----+----+----*/
+#include <dirent.h>
+#include <sys/stat.h>
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include "BatchSolver.h"
+#include "Graph.h"
+#include "SolverContext.h"
+#include "ThreadPool.h"
+
+bool BatchSolver::run(
+    const char *source)
+{
+    std::ifstream manifest;
+    struct stat info;
+
+    if (std::string(source) == "-")
+    {
+        input = &std::cin;
+    }
+    else if ((stat(source, &info) == 0) && S_ISDIR(info.st_mode))
+    {
+        DIR *directory = opendir(source);
+
+        if (directory == nullptr)
+        {
+            std::cerr << "ERROR: could not open directory '" << source << "'\n";
+            return false;
+        }
+
+        for (struct dirent *entry = readdir(directory); entry != nullptr; entry = readdir(directory))
+        {
+            std::string path = std::string(source) + "/" + entry->d_name;
+
+            if ((entry->d_name[0] != '.') && (stat(path.c_str(), &info) == 0) && S_ISREG(info.st_mode))
+            {
+                files.push_back(path);
+            }
+        }
+        closedir(directory);
+        std::sort(files.begin(), files.end());
+    }
+    else
+    {
+        manifest.open(source);
+
+        if (!manifest)
+        {
+            std::cerr << "ERROR: could not open file '" << source << "'\n";
+            return false;
+        }
+        input = &manifest;
+    }
+
+    /**
+     * The small graphs are solved one per worker, each with a context of its
+     * own that is reused by all its graphs.
+     */
+    {
+        ThreadPool pool(numThreads);
+
+        pool.run([&](int)
+        {
+            SolverContext context(1);
+            std::string filename;
+
+            while (next(filename))
+            {
+                struct stat file;
+
+                if ((numThreads > 1) && (stat(filename.c_str(), &file) == 0) && (file.st_size >= largeGraphBytes))
+                {
+                    std::lock_guard<std::mutex> guard(lock);
+                    large.push_back(filename);
+                    continue;
+                }
+                solve(filename, context);
+            }
+        });
+    }
+
+    /**
+     * The large graphs get all the threads.
+     */
+    if (!large.empty())
+    {
+        SolverContext context(numThreads);
+
+        for (const std::string &filename : large)
+        {
+            solve(filename, context);
+        }
+    }
+    large.clear();
+    input = nullptr;
+    return true;
+}
+
+bool BatchSolver::next(
+    std::string &filename)
+{
+    std::lock_guard<std::mutex> guard(lock);
+
+    if (input == nullptr)
+    {
+        if (nextFile == files.size())
+        {
+            return false;
+        }
+        filename = files[nextFile++];
+        return true;
+    }
+    std::string line;
+
+    while (std::getline(*input, line))
+    {
+        size_t begin = line.find_first_not_of(" \t\r");
+        size_t end = line.find_last_not_of(" \t\r");
+
+        if ((begin != std::string::npos) && (line[begin] != '#'))
+        {
+            filename = line.substr(begin, end - begin + 1);
+            return true;
+        }
+    }
+    return false;
+}
+
+void BatchSolver::solve(
+    const std::string &filename,
+    SolverContext &context)
+{
+    int threads = context.pool.size();
+    bool read = true;
+    Graph graph(type, filename.c_str(), read, threads);
+
+    if (!read)
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        numFailed++;
+        return;
+    }
+    std::stringstream log;
+    std::stringstream result;
+    graph.printShort(log);
+
+    Clique clique(graph, context);
+    configure(clique);
+    clique.log = &log;
+    clique.findMaxClique();
+    clique.printResult(result);
+
+    if (printCliques)
+    {
+        clique.printClique(result);
+    }
+
+    std::lock_guard<std::mutex> guard(lock);
+    numSolved++;
+    std::clog << log.str();
+    std::cout << result.str() << std::flush;
+}
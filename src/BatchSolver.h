@@ -0,0 +1,102 @@
+/**@file BatchSolver.h
+ *
+ * @brief Finds the maximum cliques of many graphs in a single process.
+ *
+ * @details The graphs are given by a manifest (a file with one filename per
+ * line; empty lines and lines that start with # are skipped), by a directory
+ * (all its files, in alphabetical order) or by the standard input, which is
+ * read as a manifest while the graphs are solved.
+ *
+ * The workers of a pool take the graphs one at a time. A graph whose file is
+ * smaller than BatchSolver::largeGraphBytes is loaded and solved by the worker
+ * that took it, with a single thread, so the small graphs are solved one per
+ * processor. Every worker keeps its context (@see SolverContext) from one
+ * graph to the next. The large ones are put aside and solved after all the small ones,
+ * one at a time and with all the threads.
+ *
+ * The result line of every graph (@see Clique::printResult) is written to the
+ * standard output as soon as the graph is solved, so the lines may not follow
+ * the order of the input. The summaries of the graphs are written to the log
+ * one after the other.
+ *
+ * @author Jose L. Walteros
+ *
+ * @version   1.0
+ * @date      June 2018
+ *
+ * Copyright (C) 2018 Jose L. Walteros. All rights reserved.
+ *
+ *---+----+----+----+----+----+----+----+----+----+----+----+----+----+----+----*/
+#ifndef _BATCHSOLVER_H_
+#define _BATCHSOLVER_H_
+
+#include <algorithm>
+#include <functional>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "Clique.h"
+#include "SolverContext.h"
+
+class BatchSolver
+{
+public:
+    static const long long largeGraphBytes = 16LL << 20; /**< Size of the files
+    * of the graphs that are solved with all the threads */
+
+    const char *type; /**< File type of the graphs (as in the command line) */
+    int numThreads; /**< Number of threads */
+    std::function<void(Clique &)> configure; /**< Sets the options of the
+    * search of every graph */
+    bool printCliques = false; /**< Whether the vertices of the maximum clique
+    * follow the result line of every graph */
+    int numSolved = 0; /**< Graphs solved */
+    int numFailed = 0; /**< Graphs that could not be read */
+
+    /**
+     * BatchSolver constructor.
+     *
+     * @param[in] type : File type of the graphs.
+     * @param[in] numThreads : Number of threads.
+     * @param[in] configure : Sets the options of the search of every graph.
+     */
+    inline BatchSolver(
+        const char *type,
+        int numThreads,
+        std::function<void(Clique &)> configure) : type(type), numThreads(std::max(numThreads, 1)),
+        configure(configure), input(nullptr), nextFile(0) {}
+
+    /**
+     * Solves the graphs of a manifest, a directory or, if source is "-", the
+     * standard input.
+     *
+     * @returns false if the source could not be read.
+     */
+    bool run(
+        const char *source);
+
+private:
+    std::mutex lock; /**< Protects the input, the output and the members below */
+    std::istream *input; /**< Manifest being read (null for a directory) */
+    std::vector<std::string> files; /**< Files of the directory */
+    size_t nextFile; /**< Next file of the directory */
+    std::vector<std::string> large; /**< Large graphs, solved at the end */
+
+    /**
+     * Takes the next filename of the input.
+     *
+     * @returns false if there are no more.
+     */
+    bool next(
+        std::string &filename);
+
+    /**
+     * Loads and solves a graph on the workers of a context and writes its
+     * result.
+     */
+    void solve(
+        const std::string &filename,
+        SolverContext &context);
+};
+#endif // _BATCHSOLVER_H_
@@ -0,0 +1,217 @@
+/**@file Bitset.h
+ *
+ * @brief Word operations on bitsets stored as arrays of 64-bit words.
+ *
+ * @details The rows of the bitset subgraphs (@see subgraph::rows) and the sets
+ * of active vertices of @see BitsetVertexCover are arrays of words. Bit i of a
+ * set is bit i % 64 of word i / 64, and the bits beyond the number of vertices
+ * are always 0.
+ *
+ * The procedures use AVX-512 or AVX2 instructions when the code is compiled for
+ * a processor that supports them (e.g., make ARCH=-march=native). The
+ * population counts use VPOPCNTDQ when it is available or the nibble lookup
+ * of W. Mula, N. Kurz and D. Lemire (Faster population counts using AVX2
+ * instructions, 2018) otherwise. The AVX-512 paths use VPTERNLOGQ, whose
+ * immediate is the truth table of the operation (0xc0: a & b, 0x30: a & ~b,
+ * 0xfc: a | b). Without those instruction sets the procedures fall back to one
+ * word at a time.
+ *
+ * @author Jose L. Walteros
+ *
+ * @version   1.0
+ * @date      June 2018
+ *
+ * Copyright (C) 2018 Jose L. Walteros. All rights reserved.
+ *
+ *---+----+----+----+----+----+----+----+----+----+----+----+----+----+----+----*/
+#ifndef _BITSET_H_
+#define _BITSET_H_
+
+#include <cstdint>
+#if defined(__AVX2__) || defined(__AVX512F__)
+#include <immintrin.h>
+#endif
+
+class Bitset
+{
+public:
+    /**
+     * Number of words needed to store n bits.
+     */
+    static inline int numWords(
+        int n)
+    {
+        return (n + 63) / 64;
+    }
+
+    static inline bool test(
+        const uint64_t *set,
+        int i)
+    {
+        return (set[i >> 6] >> (i & 63)) & 1;
+    }
+
+    static inline void set(
+        uint64_t *set,
+        int i)
+    {
+        set[i >> 6] |= uint64_t(1) << (i & 63);
+    }
+
+    static inline void reset(
+        uint64_t *set,
+        int i)
+    {
+        set[i >> 6] &= ~(uint64_t(1) << (i & 63));
+    }
+
+    static inline int popcount(
+        uint64_t word)
+    {
+        return __builtin_popcountll(word);
+    }
+
+    /**
+     * Index of the first bit of a & b at position from or later.
+     *
+     * @returns -1 if there is none.
+     */
+    static inline int next(
+        const uint64_t *a,
+        const uint64_t *b,
+        int words,
+        int from)
+    {
+        int w = from >> 6;
+
+        if (w >= words)
+        {
+            return -1;
+        }
+        uint64_t word = a[w] & b[w] & (~uint64_t(0) << (from & 63));
+
+        while (word == 0)
+        {
+            if (++w == words)
+            {
+                return -1;
+            }
+            word = a[w] & b[w];
+        }
+        return (w << 6) + __builtin_ctzll(word);
+    }
+
+    /**
+     * Number of bits in a & b.
+     */
+    static inline int countAnd(
+        const uint64_t *a,
+        const uint64_t *b,
+        int words)
+    {
+        int count = 0;
+        int w = 0;
+#if defined(__AVX512VPOPCNTDQ__)
+        __m512i sum = _mm512_setzero_si512();
+
+        for (; w + 8 <= words; w += 8)
+        {
+            __m512i x = _mm512_ternarylogic_epi64(_mm512_loadu_si512(a + w), _mm512_loadu_si512(b + w), _mm512_setzero_si512(), 0xc0);
+            sum = _mm512_add_epi64(sum, _mm512_popcnt_epi64(x));
+        }
+        alignas(64) long long sums[8];
+        _mm512_store_epi64(sums, sum);
+
+        for (int i = 0; i < 8; i++)
+        {
+            count += sums[i];
+        }
+#elif defined(__AVX2__)
+        const __m256i lookup = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+                                                0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+        const __m256i low = _mm256_set1_epi8(0x0f);
+        __m256i sum = _mm256_setzero_si256();
+
+        for (; w + 4 <= words; w += 4)
+        {
+            __m256i x = _mm256_and_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(a + w)),
+                                         _mm256_loadu_si256(reinterpret_cast<const __m256i *>(b + w)));
+            __m256i bytes = _mm256_add_epi8(_mm256_shuffle_epi8(lookup, _mm256_and_si256(x, low)),
+                                            _mm256_shuffle_epi8(lookup, _mm256_and_si256(_mm256_srli_epi16(x, 4), low)));
+            sum = _mm256_add_epi64(sum, _mm256_sad_epu8(bytes, _mm256_setzero_si256()));
+        }
+        count = _mm256_extract_epi64(sum, 0) + _mm256_extract_epi64(sum, 1) +
+                _mm256_extract_epi64(sum, 2) + _mm256_extract_epi64(sum, 3);
+#endif
+
+        for (; w < words; w++)
+        {
+            count += popcount(a[w] & b[w]);
+        }
+        return count;
+    }
+
+    /**
+     * a = a & ~b.
+     */
+    static inline void andNot(
+        uint64_t *a,
+        const uint64_t *b,
+        int words)
+    {
+        int w = 0;
+#if defined(__AVX512F__)
+
+        for (; w + 8 <= words; w += 8)
+        {
+            _mm512_storeu_si512(a + w, _mm512_ternarylogic_epi64(_mm512_loadu_si512(a + w), _mm512_loadu_si512(b + w), _mm512_setzero_si512(), 0x30));
+        }
+#elif defined(__AVX2__)
+
+        for (; w + 4 <= words; w += 4)
+        {
+            __m256i *x = reinterpret_cast<__m256i *>(a + w);
+            const __m256i *y = reinterpret_cast<const __m256i *>(b + w);
+            _mm256_storeu_si256(x, _mm256_andnot_si256(_mm256_loadu_si256(y), _mm256_loadu_si256(x)));
+        }
+#endif
+
+        for (; w < words; w++)
+        {
+            a[w] &= ~b[w];
+        }
+    }
+
+    /**
+     * result = a | b.
+     */
+    static inline void unite(
+        uint64_t *result,
+        const uint64_t *a,
+        const uint64_t *b,
+        int words)
+    {
+        int w = 0;
+#if defined(__AVX512F__)
+
+        for (; w + 8 <= words; w += 8)
+        {
+            _mm512_storeu_si512(result + w, _mm512_ternarylogic_epi64(_mm512_loadu_si512(a + w), _mm512_loadu_si512(b + w), _mm512_setzero_si512(), 0xfc));
+        }
+#elif defined(__AVX2__)
+
+        for (; w + 4 <= words; w += 4)
+        {
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(result + w),
+                                _mm256_or_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(a + w)),
+                                                _mm256_loadu_si256(reinterpret_cast<const __m256i *>(b + w))));
+        }
+#endif
+
+        for (; w < words; w++)
+        {
+            result[w] = a[w] | b[w];
+        }
+    }
+};
+#endif // _BITSET_H_
@@ -0,0 +1,331 @@
+/**@file BitsetVertexCover.cpp
+ *
+ * @brief Finds if a graph stored as bitsets has a vertex cover of size k.
+ *
+ * @details Every node removes the isolated vertices, takes the vertices of
+ * degree larger than k and the neighbors of the vertices of degree 1, and
+ * removes (or folds) the vertices of degree 2. Then, it branches on the vertex
+ * a with the largest degree: a is in the vertex cover, or N(a) is.
+ *
+ * @author Jose L. Walteros
+ *
+ * @version   1.0
+ * @date      June 2018
+ *
+ * Copyright (C) 2018 Jose L. Walteros. All rights reserved.
+ *
+ *---+----+----+----+----+----+----+----+----+----+----+----+----+----+----+----*/
+#include <vector>
+#include "BitsetVertexCover.h"
+#include "Bitset.h"
+#include "Scheduler.h"
+
+bool BitsetVertexCover::kVertexCover(
+    subgraph &sG,
+    int k)
+{
+    this->sG = &sG;
+    n = sG.n;
+    words = sG.words;
+    std::vector<uint64_t> active(words, 0);
+
+    for (int i = 0; i < n; i++)
+    {
+        Bitset::set(active.data(), i);
+    }
+    return search(sG.rows.data(), active, n, k);
+}
+
+bool BitsetVertexCover::search(
+    const uint64_t *rows,
+    std::vector<uint64_t> &active,
+    int numActive,
+    int k)
+{
+    VC.countNode();
+
+    if (VC.cancelled())
+    {
+        return false;
+    }
+
+    std::vector<uint64_t> folded;
+    size_t stepsMark = VC.steps.size();
+    int a = -1;
+    int degreeA = 0;
+    int success = degreePreprocessing(rows, folded, active.data(), numActive, k, a, degreeA);
+
+    if (success == -1)
+    {
+        VC.steps.resize(stepsMark);
+        return false;
+    }
+
+    if (success == 1)
+    {
+        return true;
+    }
+    size_t branchStepsMark = VC.steps.size();
+
+    /**
+     * Active vertices of the upper branch: a is in the vertex cover.
+     */
+    std::vector<uint64_t> activeUp(active);
+    Bitset::reset(activeUp.data(), a);
+    const uint64_t *rowA = rows + a * words;
+
+    /**
+     * If there are idle workers, the lower branch (N(a) is in the vertex
+     * cover) is published as a task and this thread only explores the upper
+     * branch.
+     */
+    bool published = false;
+    Scheduler *scheduler = VC.scheduler;
+
+    if ((scheduler != nullptr) && (numActive >= Scheduler::minTaskSize) && scheduler->needsTasks())
+    {
+        takeNeighbors(rowA, active.data());
+        Bitset::andNot(active.data(), rowA, words);
+        Bitset::reset(active.data(), a);
+        publish(rows, active.data(), numActive - 1 - degreeA, k - degreeA);
+        VC.steps.resize(branchStepsMark);
+        published = true;
+    }
+
+    VC.take(sG->vertices[a].v);
+
+    if (search(rows, activeUp, numActive - 1, k - 1))
+    {
+        return true;
+    }
+    VC.steps.resize(branchStepsMark);
+
+    if (!published)
+    {
+        /**
+         * Active vertices of the lower branch. The neighbors of a are recorded
+         * before they are removed.
+         */
+        takeNeighbors(rowA, active.data());
+        Bitset::andNot(active.data(), rowA, words);
+        Bitset::reset(active.data(), a);
+
+        if (search(rows, active, numActive - 1 - degreeA, k - degreeA))
+        {
+            return true;
+        }
+    }
+    VC.steps.resize(stepsMark);
+    return false;
+}
+
+void BitsetVertexCover::takeNeighbors(
+    const uint64_t *row,
+    const uint64_t *active)
+{
+    for (int x = Bitset::next(row, active, words, 0); x != -1; x = Bitset::next(row, active, words, x + 1))
+    {
+        VC.take(sG->vertices[x].v);
+    }
+}
+
+int BitsetVertexCover::degreePreprocessing(
+    const uint64_t *&rows,
+    std::vector<uint64_t> &folded,
+    uint64_t *active,
+    int &numActive,
+    int &k,
+    int &a,
+    int &degreeA)
+{
+    bool change = true;
+
+    while (change && numActive > k && k >= 0)
+    {
+        change = false;
+
+        for (int i = Bitset::next(active, active, words, 0); i != -1; i = Bitset::next(active, active, words, i + 1))
+        {
+            if (VC.cancelled())
+            {
+                return -1;
+            }
+
+            const uint64_t *row = rows + i * words;
+            int degree = Bitset::countAnd(row, active, words);
+
+            /**
+             * If i has degree > k, it is in the vertex cover.
+             */
+            if (degree > k)
+            {
+                VC.take(sG->vertices[i].v);
+                Bitset::reset(active, i);
+                numActive--;
+                k--;
+                change = true;
+                continue;
+            }
+
+            /**
+             * If i is isolated, it is removed.
+             */
+            if (degree == 0)
+            {
+                Bitset::reset(active, i);
+                numActive--;
+                continue;
+            }
+
+            /**
+             * If i has degree 1, its neighbor is in the vertex cover.
+             */
+            if (degree == 1)
+            {
+                int u = Bitset::next(row, active, words, 0);
+                VC.take(sG->vertices[u].v);
+                Bitset::reset(active, i);
+                Bitset::reset(active, u);
+                numActive -= 2;
+                k--;
+                change = true;
+                continue;
+            }
+
+            if (degree == 2)
+            {
+                int u = Bitset::next(row, active, words, 0);
+                int w = Bitset::next(row, active, words, u + 1);
+                change = true;
+
+                /**
+                 * If the neighbors are adjacent, both are in the vertex cover.
+                 */
+                if (Bitset::test(rows + u * words, w))
+                {
+                    VC.take(sG->vertices[u].v);
+                    VC.take(sG->vertices[w].v);
+                    Bitset::reset(active, i);
+                    Bitset::reset(active, u);
+                    Bitset::reset(active, w);
+                    numActive -= 3;
+                    k -= 2;
+                    continue;
+                }
+
+                /**
+                 * Otherwise, u and w are removed and their neighbors are
+                 * attached to i (vertex folding).
+                 */
+                VC.recordFold(sG->vertices[i].v, sG->vertices[u].v, sG->vertices[w].v);
+
+                if (folded.empty())
+                {
+                    folded.assign(rows, rows + n * words);
+                    rows = folded.data();
+                }
+                uint64_t *rowI = folded.data() + i * words;
+                Bitset::unite(rowI, rows + u * words, rows + w * words, words);
+                Bitset::reset(rowI, i);
+                Bitset::reset(active, u);
+                Bitset::reset(active, w);
+                numActive -= 2;
+                k--;
+
+                for (int x = Bitset::next(rowI, active, words, 0); x != -1; x = Bitset::next(rowI, active, words, x + 1))
+                {
+                    Bitset::set(folded.data() + x * words, i);
+                }
+            }
+        }
+    }
+
+    if (k < 0)
+    {
+        return -1;
+    }
+
+    if (numActive <= k)
+    {
+        /**
+         * The vertices that are left form a vertex cover.
+         */
+        std::vector<int> remaining;
+
+        for (int i = Bitset::next(active, active, words, 0); i != -1; i = Bitset::next(active, active, words, i + 1))
+        {
+            remaining.push_back(sG->vertices[i].v);
+        }
+        VC.coverFound(remaining);
+        return 1;
+    }
+
+    if (k == 0)
+    {
+        return -1;
+    }
+
+    /**
+     * Finds the vertex used for branching. As all the active vertices have
+     * degree at most k, there is no vertex cover if there are more than k * k
+     * edges.
+     */
+    int m = 0;
+    degreeA = 0;
+
+    for (int i = Bitset::next(active, active, words, 0); i != -1; i = Bitset::next(active, active, words, i + 1))
+    {
+        int degree = Bitset::countAnd(rows + i * words, active, words);
+        m += degree;
+
+        if (degree > degreeA)
+        {
+            degreeA = degree;
+            a = i;
+        }
+    }
+
+    if (m / 2 > k * k)
+    {
+        return -1;
+    }
+    return 0;
+}
+
+void BitsetVertexCover::publish(
+    const uint64_t *rows,
+    const uint64_t *active,
+    int numActive,
+    int k)
+{
+    vcTask task;
+    task.n = numActive;
+    task.k = k;
+    task.root = VC.root;
+    task.steps = VC.steps;
+    task.vertices = std::vector<vertex>(numActive);
+    task.adjLists = std::vector<std::vector<int> >(numActive);
+    std::vector<int> mask(n);
+    int count = 0;
+
+    for (int i = Bitset::next(active, active, words, 0); i != -1; i = Bitset::next(active, active, words, i + 1))
+    {
+        task.vertices[count].v = sG->vertices[i].v;
+        task.vertices[count].degree = 0;
+        task.vertices[count].pos = count;
+        mask[i] = count++;
+    }
+
+    for (int i = Bitset::next(active, active, words, 0); i != -1; i = Bitset::next(active, active, words, i + 1))
+    {
+        const uint64_t *row = rows + i * words;
+
+        for (int x = Bitset::next(row, active, words, 0); x != -1; x = Bitset::next(row, active, words, x + 1))
+        {
+            task.adjLists[mask[i]].push_back(mask[x]);
+            task.vertices[mask[i]].degree++;
+        }
+    }
+    VC.numPublished++;
+    VC.scheduler->push(VC.worker, std::move(task));
+}
@@ -0,0 +1,124 @@
+/**@file BitsetVertexCover.h
+ *
+ * @brief Finds if a graph stored as bitsets has a vertex cover of size k.
+ *
+ * @details This is the bitset backend of @see VertexCover. The subgraph keeps
+ * its adjacency matrix as one bitset per vertex (@see subgraph::rows) and every
+ * node of the recursion only stores the set of vertices that are still in the
+ * graph (the active set). The degree of a vertex is the population count of
+ * its row AND the active set, and removing vertices, or the closed neighborhood
+ * of a vertex, is an ANDNOT. The matrix is only copied by the nodes that fold
+ * a vertex of degree 2.
+ *
+ * Every node applies the same rules of @see VertexCover::degreePreprocessing,
+ * including the one of the Buss kernel (vertices of degree larger than k are
+ * in the cover), and then branches on the vertex with the largest degree. The
+ * backend pays off when the complement graphs are dense, as a row of a few
+ * words replaces a long adjacency list.
+ *
+ * The recursion shares the cancellation token, the scheduler and the counters
+ * of the VertexCover object of its worker. The branches published for the
+ * other workers are converted to adjacency lists, so they can be solved by any
+ * backend.
+ *
+ * @author Jose L. Walteros
+ *
+ * @version   1.0
+ * @date      June 2018
+ *
+ * Copyright (C) 2018 Jose L. Walteros. All rights reserved.
+ *
+ *---+----+----+----+----+----+----+----+----+----+----+----+----+----+----+----*/
+#ifndef _BITSETVERTEXCOVER_H_
+#define _BITSETVERTEXCOVER_H_
+
+#include <cstdint>
+#include <vector>
+#include "Graph.h"
+#include "VertexCover.h"
+
+class BitsetVertexCover
+{
+public:
+    VertexCover &VC; /**< Solver of the worker (token, scheduler and counters) */
+    subgraph *sG; /**< Graph being solved */
+    int n; /**< Number of vertices of sG */
+    int words; /**< Words per row */
+
+    /**
+     * BitsetVertexCover constructor.
+     *
+     * @param[in] VC : Solver of the worker that runs the recursion.
+     */
+    inline BitsetVertexCover(
+        VertexCover &VC) : VC(VC), sG(nullptr), n(0), words(0) {}
+
+    /**
+     * Finds if sG has a vertex cover of size k. sG must have been generated
+     * with bitset rows (@see Graph::generateCompGraphRightNeighbors).
+     *
+     * @param[in] sG : The graph.
+     * @param[in] k : Expected size of the vertex cover.
+     */
+    bool kVertexCover(
+        subgraph &sG,
+        int k);
+
+    /**
+     * Node of the recursion.
+     *
+     * @param[in] rows : Adjacency matrix of the node.
+     * @param[in] active : Vertices in the graph of the node (it is modified).
+     * @param[in] numActive : Number of active vertices.
+     * @param[in] k : Expected size of the vertex cover.
+     */
+    bool search(
+        const uint64_t *rows,
+        std::vector<uint64_t> &active,
+        int numActive,
+        int k);
+
+    /**
+     * Applies the degree rules of VertexCover::degreePreprocessing to the
+     * active vertices until there is no further update. A vertex of degree 2
+     * whose neighbors are not adjacent is folded into a copy of the matrix,
+     * after which rows points to the copy.
+     *
+     * @param[in,out] rows : Adjacency matrix of the node.
+     * @param[out] folded : Storage of the copy of the matrix.
+     * @param[in,out] active : Active vertices.
+     * @param[in,out] numActive : Number of active vertices.
+     * @param[in,out] k : Expected size of the vertex cover.
+     * @param[out] a : Active vertex with the largest degree.
+     * @param[out] degreeA : Degree of a.
+     *
+     * @returns 1 if there is a vertex cover, -1 if there is none and 0 if the
+     * node must branch.
+     */
+    int degreePreprocessing(
+        const uint64_t *&rows,
+        std::vector<uint64_t> &folded,
+        uint64_t *active,
+        int &numActive,
+        int &k,
+        int &a,
+        int &degreeA);
+
+    /**
+     * Records that the active vertices of row are in the vertex cover.
+     */
+    void takeNeighbors(
+        const uint64_t *row,
+        const uint64_t *active);
+
+    /**
+     * Publishes the graph induced by the active vertices as a task of the
+     * scheduler, in adjacency lists form, together with the current steps.
+     */
+    void publish(
+        const uint64_t *rows,
+        const uint64_t *active,
+        int numActive,
+        int k);
+};
+#endif // _BITSETVERTEXCOVER_H_
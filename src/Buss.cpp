@@ -50,6 +50,7 @@ int Buss::getKernel(
     {
         if (i->degree > k) {
             removed[i->pos] = true;
+            inCover.push_back(i->v);
             highDegVertices++;
             numRemoved++;
         }
@@ -79,6 +80,11 @@ int Buss::getKernel(
      */
     for (std::vector<vertex>::iterator i = sG->vertices.begin(); i < sG->vertices.end(); i++)
     {
+        if (cancelled())
+        {
+            return -1;
+        }
+
         if (removed[i->pos] == false)
         {
             bool isolated = true;
@@ -116,6 +122,10 @@ int Buss::getKernel(
      */
     if (kernel.n <= k - highDegVertices)
     {
+        for (int i = 0; i < kernel.n; i++)
+        {
+            inCover.push_back(kernel.vertices[i].v);
+        }
         return 1;
     }
 
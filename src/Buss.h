@@ -17,6 +17,9 @@
  * If the resulting number of edges is greater than k*(k-highDegVertices), the
  * procedure returns -1 as there is no VC.
  *
+ * If the cancellation token is set while the kernel is generated, the procedure
+ * stops and returns -1.
+ *
  * @author Jose L. Walteros
  *
  * @version   1.0
@@ -29,6 +32,8 @@
 #define _BUSS_H_
 
 #include <iostream>
+#include <atomic>
+#include <vector>
 #include "Graph.h"
 
 class Buss
@@ -36,19 +41,33 @@ class Buss
 public:
     subgraph *sG; /**< Subgraph to be processed.*/
     int k; /**< Expected size of the VC.*/
+    const std::atomic<bool> *cancel; /**< Cancellation token (may be null).*/
+    std::vector<int> inCover; /**< Names of the vertices that are in the VC (the
+    * high degree vertices, and the whole kernel if the procedure returns 1).*/
 
     /**
      * Buss constructor: Receives the graph to be processed and the expected VC
      * size.
      * @param[in] sG : Subgraph to be processed.
      * @param[in] k : Expected size of the VC.
+     * @param[in] cancel : If not null, the procedure stops once it is set.
      */
     inline Buss(
         subgraph *sG,
-        int k)
+        int k,
+        const std::atomic<bool> *cancel = nullptr)
     {
         this->sG = sG;
         this->k = k;
+        this->cancel = cancel;
+    }
+
+    /**
+     * Whether the cancellation token has been set.
+     */
+    inline bool cancelled() const
+    {
+        return (cancel != nullptr) && cancel->load(std::memory_order_relaxed);
     }
 
     /**
@@ -0,0 +1,1229 @@
+/**
+ * @file Clique.cpp
+ *
+ * @brief Finds The maximum clique of a graph.
+ *
+ * @details This code implements an efficient algorithm for the maximum clique
+ * problem that runs in time polynomial in the graph's size, but exponential
+ * in the difference $d-\omega$ (where $d$ denotes the graph's degeneracy).
+ * When this difference is a constant, the running time is ${O}(dm)={O}(m^{1.5})$.
+ * Since 70% of common test instances have $d-\omega \le 3$, our implementation
+ * performs rather well and is competitive with previous approaches.
+ * Key subroutines in our approach include existing kernelization and
+ * fixed-parameter tractable algorithms for vertex cover.
+ *
+ * Please cite the following paper if used:
+ * Jose L. Walteros and Austin L. Buchanan. Why is maximum clique easy in practice?
+ *
+ * @author Jose L. Walteros
+ *
+ * @version   1.0
+ * @date      June 2018
+ *
+ * Copyright (C) 2018 Jose L. Walteros. All rights reserved.
+ *
+ *---+----+----+----+----+----+----+----+----+----+----+----+----+----+----+----*/
+
+#include <math.h>
+#include <chrono>
+#include <iostream>
+#include <sstream>
+#include <algorithm>
+#include <thread>
+#include "Clique.h"
+#include "Graph.h"
+#include "NemhauserTrotter.h"
+#include "Buss.h"
+#include "VertexCover.h"
+#include "BitsetVertexCover.h"
+#include "UndoVertexCover.h"
+#include "Scheduler.h"
+#include "CliqueHeuristic.h"
+#include "SearchStats.h"
+
+void Clique::abandonTests(
+    int clq,
+    bool larger)
+{
+    for (sizeTest &test : tests)
+    {
+        if (larger ? (test.clq > clq) : (test.clq < clq))
+        {
+            test.abandoned = true;
+            test.stop = true;
+        }
+    }
+}
+
+void Clique::signalClique(
+    VertexCover &VC,
+    sizeTest &test)
+{
+    if (!test.found.exchange(true))
+    {
+        test.stop = true;
+        test.foundTime = std::chrono::high_resolution_clock::now();
+
+        if (cluster != nullptr)
+        {
+            cluster->setFound(&test - tests.data());
+        }
+
+        /**
+         * A clique of size clq contains cliques of every smaller size.
+         */
+        abandonTests(test.clq, false);
+
+        /**
+         * The clique is the set of vertices of the subgraph that are not in
+         * the vertex cover of its complement.
+         */
+        std::vector<int> inCover(VC.cover);
+        std::sort(inCover.begin(), inCover.end());
+        subgraph sG;
+        graph.rightNeighborhood(VC.root, sG);
+
+        for (const vertex &u : sG.vertices)
+        {
+            if (!std::binary_search(inCover.begin(), inCover.end(), u.v))
+            {
+                test.clique.push_back(u.v);
+            }
+        }
+    }
+}
+
+bool Clique::solveVertexCover(
+    VertexCover &VC,
+    int n,
+    int k,
+    std::vector<vertex> &vertices,
+    std::vector<std::vector<int> > &adjLists)
+{
+    if (undoLog)
+    {
+        UndoVertexCover UVC(VC);
+        return UVC.kVertexCover(n, k, vertices, adjLists);
+    }
+    return VC.kVertexCover(n, k, vertices, adjLists);
+}
+
+void Clique::processTask(
+    VertexCover &VC,
+    sizeTest &test,
+    vcTask &task)
+{
+    long long nodes = VC.numNodes;
+    VC.root = task.root;
+    VC.steps.swap(task.steps);
+    std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
+    bool found = solveVertexCover(VC, task.n, task.k, task.vertices, task.adjLists);
+    VC.searchTime += std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+
+    if (found)
+    {
+        signalClique(VC, test);
+    }
+    else if (VC.cancelled())
+    {
+        VC.numCancelled++;
+        VC.wastedNodes += VC.numNodes - nodes;
+    }
+}
+
+bool Clique::filterVertex(
+    VertexCover &VC,
+    NeighborhoodGraph &nG,
+    int v,
+    int clq)
+{
+    int core = coreBound[v].load(std::memory_order_acquire);
+
+    if (core < 0)
+    {
+        /**
+         * The coloring takes the vertices in the reverse peeling order, so it
+         * uses at most the largest core number + 1 colors.
+         */
+        nG.build(v);
+        core = nG.coreNumbers() + 2;
+        int colors = (filter == coloringFilter) ? nG.greedyColoring() + 1 : core;
+        colorBound[v].store(colors, std::memory_order_relaxed);
+        coreBound[v].store(core, std::memory_order_release);
+    }
+
+    if (core < clq)
+    {
+        VC.numCoreFiltered++;
+        return true;
+    }
+
+    if (colorBound[v].load(std::memory_order_relaxed) < clq)
+    {
+        VC.numColorFiltered++;
+        return true;
+    }
+    return false;
+}
+
+int Clique::processVertex(
+    VertexCover &VC,
+    NeighborhoodGraph &nG,
+    ntWorkspace &ntWS,
+    workerStats &stats,
+    int v,
+    int clq)
+{
+    int k = graph.rightDegree[v] + 1 - clq;
+
+    if (k < 0)
+    {
+        return -1;
+    }
+
+    if ((filter != noFilter) && filterVertex(VC, nG, v, clq))
+    {
+        return 0;
+    }
+
+    /**
+     * A subgraph without a vertex cover of size k has none of a smaller size.
+     */
+    if (k <= infeasibleK[v].load(std::memory_order_relaxed))
+    {
+        VC.numKnownInfeasible++;
+        return 0;
+    }
+
+    /**
+     * Takes the subgraph of v from the cache, which generates it if needed.
+     */
+    std::chrono::high_resolution_clock::time_point start;
+
+    if (statsEnabled)
+    {
+        start = std::chrono::high_resolution_clock::now();
+    }
+    std::shared_ptr<subgraph> sG = cache.get(v);
+
+    if (statsEnabled)
+    {
+        stats.numSubgraphs++;
+        stats.subgraphTime += std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+    }
+    long long nodes = VC.numNodes;
+    long long published = VC.numPublished;
+    int success = 0;
+    VC.root = v;
+    VC.steps.clear();
+
+    if (backend == bitsetBackend)
+    {
+        /**
+         * The bitset backend applies the Buss rule at every node of the
+         * recursion (@see BitsetVertexCover).
+         */
+        std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
+        BitsetVertexCover BVC(VC);
+        success = BVC.kVertexCover(*sG, k) ? 1 : -1;
+        VC.searchTime += std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+
+        if (statsEnabled)
+        {
+            stats.input.add(sG->n, sG->m);
+            stats.numSearched++;
+        }
+    }
+    else
+    {
+        success = processLists(VC, ntWS, stats, *sG, k);
+    }
+
+    if ((success != 1) && VC.cancelled())
+    {
+        VC.numCancelled++;
+        VC.wastedNodes += VC.numNodes - nodes;
+    }
+    else if ((success != 1) && (VC.numPublished == published))
+    {
+        /**
+         * The subgraph was solved here (no branch of it was published), so
+         * it has no vertex cover of size k.
+         */
+        int known = infeasibleK[v].load(std::memory_order_relaxed);
+
+        while ((known < k) && !infeasibleK[v].compare_exchange_weak(known, k, std::memory_order_relaxed))
+        {
+        }
+    }
+    return (success == 1) ? 1 : 0;
+}
+
+int Clique::processLists(
+    VertexCover &VC,
+    ntWorkspace &ntWS,
+    workerStats &stats,
+    subgraph &sG,
+    int k)
+{
+    std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
+    double searched = 0;
+
+    /**
+     * Generates the Buss kernel. If another thread finds a clique in the
+     * meantime, the kernels and the vertex cover search stop right away and
+     * the subgraph is counted as wasted work.
+     */
+    Buss BusKernel(&sG, k, VC.cancel);
+    subgraph kernel;
+    int highDegVertices = 0;
+    int success = BusKernel.getKernel(kernel, highDegVertices);
+    std::chrono::high_resolution_clock::time_point bussEnd;
+
+    if (statsEnabled)
+    {
+        bussEnd = std::chrono::high_resolution_clock::now();
+        stats.bussTime += std::chrono::duration<double>(bussEnd - start).count();
+        stats.input.add(sG.n, sG.m);
+
+        if (success == 0)
+        {
+            stats.buss.add(kernel.n, kernel.m);
+        }
+        else
+        {
+            stats.numBussDecided++;
+        }
+    }
+
+    /**
+     * The vertices that the kernels put in the vertex cover are recorded, so
+     * the cover (and the clique) can be rebuilt.
+     */
+    for (int u : BusKernel.inCover)
+    {
+        VC.take(u);
+    }
+
+    if (success == 1)
+    {
+        VC.coverFound(std::vector<int>());
+    }
+    else if (success == 0)
+    {
+        k = k - highDegVertices;
+
+        /**
+         * Generates the NT kernel.
+         */
+        subgraph kernel2;
+        int numRemoved = 0;
+        int numInVC = 0;
+        NemhauserTrotter NT(&kernel, k, VC.cancel, &ntWS);
+
+        /**
+         * The Buss kernel is an induced subgraph of sG, whose vertices keep
+         * their relative order. The matching of the previous NT kernel of sG
+         * (for another k) is the starting point of the new one.
+         */
+        std::vector<int> origin(kernel.n);
+
+        for (int i = 0, j = 0; i < kernel.n; i++, j++)
+        {
+            while (sG.vertices[j].v != kernel.vertices[i].v)
+            {
+                j++;
+            }
+            origin[i] = j;
+        }
+        std::vector<int> mate;
+
+        if (cache.getMatching(VC.root, mate))
+        {
+            NT.warmStart(mate, origin);
+        }
+        else
+        {
+            mate.assign(sG.n, -1);
+        }
+        success = NT.getKernel(kernel2, numRemoved, numInVC);
+        NT.saveMatching(mate, origin);
+        cache.putMatching(VC.root, mate);
+
+        if (statsEnabled)
+        {
+            stats.ntTime += std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - bussEnd).count();
+
+            if (success == 0)
+            {
+                stats.nt.add(kernel2.n, kernel2.m);
+                stats.numSearched++;
+            }
+            else
+            {
+                stats.numNTDecided++;
+            }
+        }
+
+        for (int u : NT.inCover)
+        {
+            VC.take(u);
+        }
+
+        if (success == 1)
+        {
+            VC.coverFound(std::vector<int>());
+        }
+        else if (success == 0)
+        {
+            k = k - numInVC;
+
+            /**
+             * Solves the resulting k vertex cover problem.
+             */
+            std::chrono::high_resolution_clock::time_point searchStart = std::chrono::high_resolution_clock::now();
+            success = solveVertexCover(VC, kernel2.n, k, kernel2.vertices, kernel2.adjLists) ? 1 : -1;
+            searched = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - searchStart).count();
+        }
+    }
+    VC.searchTime += searched;
+    VC.kernelTime += std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count() - searched;
+    return success;
+}
+
+void Clique::processSubgraphs(
+    sizeTest &test,
+    int threadNumber)
+{
+    Scheduler &scheduler = *test.scheduler;
+    int worker = threadNumber - test.firstWorker;
+    VertexCover &VC = solvers[threadNumber];
+    VC.scheduler = &scheduler;
+    VC.worker = worker;
+    VC.cancel = &test.stop;
+    vcTask task;
+    int first;
+    int last;
+
+    while (!test.stop)
+    {
+        /**
+         * The tasks published by this worker are solved first (depth first),
+         * then the next chunk of the sorted list is processed and finally the
+         * worker tries to steal the tasks published by the others.
+         */
+        if (scheduler.pop(worker, task))
+        {
+            processTask(VC, test, task);
+            continue;
+        }
+
+        if (scheduler.nextVertices(first, last))
+        {
+            for (int i = first; (i < last) && !test.stop; i++)
+            {
+                int success = processVertex(VC, neighborhoods[threadNumber], ntWorkspaces[threadNumber], stats[threadNumber], sortedList[i], test.clq);
+
+                if (success == -1)
+                {
+                    scheduler.stopAt(i);
+                    break;
+                }
+
+                if (success == 1)
+                {
+                    signalClique(VC, test);
+                }
+            }
+            continue;
+        }
+
+        if (!scheduler.waitForTask(worker, task))
+        {
+            break;
+        }
+        processTask(VC, test, task);
+    }
+    VC.scheduler = nullptr;
+    VC.cancel = nullptr;
+    stopTimes[threadNumber] = std::chrono::high_resolution_clock::now();
+
+    /**
+     * The stop flag is only set after found or abandoned, so a group that
+     * ends with neither has processed all its work.
+     */
+    if ((test.running.fetch_sub(1) == 1) && !test.found && !test.abandoned)
+    {
+        test.exhausted = true;
+
+        /**
+         * A graph without cliques of size clq has no larger cliques either.
+         * If the test is shared with other processes, that is only known once
+         * all of them have run out of work (@see Clique::pollCluster).
+         */
+        if (cluster != nullptr)
+        {
+            cluster->setDone(&test - tests.data());
+        }
+        else
+        {
+            abandonTests(test.clq, true);
+        }
+    }
+}
+
+void Clique::pollCluster(
+    const std::atomic<bool> &finished)
+{
+    std::vector<int> found;
+    std::vector<int> done;
+    std::vector<bool> known(tests.size(), false);
+
+    while (!finished)
+    {
+        cluster->poll(found, done);
+
+        for (size_t g = 0; g < tests.size(); g++)
+        {
+            sizeTest &test = tests[g];
+
+            if ((found[g] != 0) && !test.found.exchange(true))
+            {
+                /**
+                 * Another process found the clique, and has its vertices.
+                 */
+                test.stop = true;
+                test.foundTime = std::chrono::high_resolution_clock::now();
+                abandonTests(test.clq, false);
+            }
+            else if ((found[g] == 0) && (done[g] == cluster->size()) && !known[g])
+            {
+                known[g] = true;
+                abandonTests(test.clq, true);
+            }
+        }
+        std::this_thread::sleep_for(std::chrono::microseconds((long)Cluster::pollMicroseconds));
+    }
+}
+
+bool Clique::overBudget(
+    std::chrono::high_resolution_clock::time_point begin_time)
+{
+    if ((timeLimit > 0) && (std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - begin_time).count() >= timeLimit))
+    {
+        return true;
+    }
+    return (nodeLimit > 0) && (budgetNodes.load(std::memory_order_relaxed) >= nodeLimit);
+}
+
+void Clique::watchBudget(
+    std::chrono::high_resolution_clock::time_point begin_time,
+    const std::atomic<bool> &finished)
+{
+    while (!finished)
+    {
+        /**
+         * The tests stopped by the budget are neither found nor exhausted,
+         * so they leave the bounds as they are.
+         */
+        if (overBudget(begin_time))
+        {
+            budgetSpent = true;
+
+            for (sizeTest &test : tests)
+            {
+                test.abandoned = true;
+                test.stop = true;
+            }
+            return;
+        }
+        std::this_thread::sleep_for(std::chrono::microseconds((long)budgetPollMicroseconds));
+    }
+}
+
+void Clique::shareOutcomes()
+{
+    std::vector<int> found;
+    std::vector<int> done;
+    cluster->poll(found, done);
+    int largest = 0;
+    std::vector<int> vertices;
+
+    for (size_t g = 0; g < tests.size(); g++)
+    {
+        sizeTest &test = tests[g];
+        test.found = (found[g] != 0);
+        test.exhausted = (found[g] == 0) && (done[g] == cluster->size());
+
+        /**
+         * Only the processes that found a clique have its vertices.
+         */
+        if (test.found && !test.clique.empty() && (test.clq > largest))
+        {
+            largest = test.clq;
+            vertices = test.clique;
+        }
+    }
+    largest = cluster->largest(largest, vertices);
+
+    for (sizeTest &test : tests)
+    {
+        if (test.clq == largest)
+        {
+            test.clique = vertices;
+        }
+    }
+}
+
+Clique::Clique(
+    Graph &graph,
+    const int numThreads) : graph(graph), cache(graph), ownContext(new SolverContext(numThreads)), context(*ownContext),
+    pool(context.pool), solvers(context.solvers), ntWorkspaces(context.ntWorkspaces), stopTimes(pool.size())
+{
+    this->numThreads = pool.size();
+
+    for (int i = 0; i < this->numThreads; i++)
+    {
+        neighborhoods.emplace_back(graph);
+    }
+}
+
+Clique::Clique(
+    Graph &graph,
+    SolverContext &context) : graph(graph), cache(graph), context(context), pool(context.pool),
+    solvers(context.solvers), ntWorkspaces(context.ntWorkspaces), stopTimes(pool.size())
+{
+    this->numThreads = pool.size();
+
+    for (int i = 0; i < this->numThreads; i++)
+    {
+        neighborhoods.emplace_back(graph);
+    }
+}
+
+void Clique::searchSizes(
+    std::chrono::high_resolution_clock::time_point begin_time)
+{
+    std::unique_ptr<SearchStrategy> strategy = SearchStrategy::create(search);
+    std::vector<int> sizes;
+    std::vector<int> groupOf(numThreads);
+
+    /**
+     * The processes of a cluster test the sizes chosen by rank 0, in
+     * groups that every one of them can fill.
+     */
+    int numWorkers = (cluster != nullptr) ? cluster->minimum(numThreads) : numThreads;
+    bool budgeted = (cluster == nullptr) && ((timeLimit > 0) || (nodeLimit > 0));
+
+    while (cliqueLB < cliqueUB)
+    {
+        if (budgeted && overBudget(begin_time))
+        {
+            budgetSpent = true;
+            break;
+        }
+        strategy->next(cliqueLB, cliqueUB, numWorkers, sizes);
+
+        if (cluster != nullptr)
+        {
+            cluster->broadcast(sizes);
+        }
+        int numGroups = sizes.size();
+        std::vector<sizeTest>(numGroups).swap(tests);
+        numIterations++;
+        numTested += numGroups;
+
+        /**
+         * The workers are split into one group (of consecutive workers)
+         * per clique size.
+         */
+        for (int g = 0; g < numGroups; g++)
+        {
+            sizeTest &test = tests[g];
+            test.clq = sizes[g];
+            test.firstWorker = (g * numThreads) / numGroups;
+            test.numWorkers = ((g + 1) * numThreads) / numGroups - test.firstWorker;
+            test.stop = false;
+            test.found = false;
+            test.abandoned = false;
+            test.running = test.numWorkers;
+            test.exhausted = false;
+            test.foundTime = std::chrono::high_resolution_clock::time_point();
+            test.scheduler.reset(new Scheduler(test.numWorkers, (int)sortedList.size(), chunkSize, test.stop));
+
+            if (cluster != nullptr)
+            {
+                test.scheduler->refill = [this, g](int &first, int &last)
+                {
+                    return cluster->nextBlock(g, chunkSize * Cluster::blockChunks, (int)sortedList.size(), first, last);
+                };
+            }
+
+            /**
+             * The vertices whose right degree is smaller than clq - 1
+             * (at the end of the sorted list) are never processed.
+             */
+            numDegreeFiltered += sortedList.end() - std::partition_point(sortedList.begin(), sortedList.end(),
+                                 [this, &test](int v) { return graph.rightDegree[v] + 1 >= test.clq; });
+
+            for (int i = test.firstWorker; i < test.firstWorker + test.numWorkers; i++)
+            {
+                groupOf[i] = g;
+            }
+        }
+        std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
+        std::atomic<bool> finished(false);
+        std::thread poller;
+
+        if (cluster != nullptr)
+        {
+            cluster->beginIteration(numGroups);
+            poller = std::thread([this, &finished]() { pollCluster(finished); });
+        }
+        else if (budgeted)
+        {
+            poller = std::thread([this, begin_time, &finished]() { watchBudget(begin_time, finished); });
+        }
+
+        /**
+         * Every worker of the pool processes the subgraphs of its group
+         * until the scheduler runs out of work or the test is stopped.
+         */
+        pool.run([&](int i)
+        {
+            std::chrono::high_resolution_clock::time_point busyStart;
+
+            if (statsEnabled)
+            {
+                busyStart = std::chrono::high_resolution_clock::now();
+            }
+            processSubgraphs(tests[groupOf[i]], i);
+
+            if (statsEnabled)
+            {
+                double busy = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - busyStart).count();
+                stats[i].busyTime.push_back(busy);
+                stats[i].events.push_back({"clique size", tests[groupOf[i]].clq,
+                                           std::chrono::duration<double>(busyStart - begin_time).count(), busy});
+            }
+        });
+
+        finished = true;
+
+        if (poller.joinable())
+        {
+            poller.join();
+        }
+
+        if (cluster != nullptr)
+        {
+            cluster->endIteration();
+            shareOutcomes();
+        }
+
+        if (statsEnabled)
+        {
+            iterationTime.push_back(std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count());
+            iterationSizes.push_back(sizes);
+        }
+
+        bool success = false;
+
+        for (sizeTest &test : tests)
+        {
+            std::chrono::high_resolution_clock::time_point stop = start;
+
+            for (int i = test.firstWorker; i < test.firstWorker + test.numWorkers; i++)
+            {
+                stop = std::max(stop, stopTimes[i]);
+            }
+
+            if (test.found && (test.foundTime == std::chrono::high_resolution_clock::time_point()))
+            {
+                /**
+                 * The clique was found by another process after this one
+                 * had run out of work.
+                 */
+                test.foundTime = stop;
+            }
+
+            if (test.found)
+            {
+                /**
+                 * Time it took the last worker of the group to stop
+                 * after the clique was found.
+                 */
+                cancelLatency = std::max(cancelLatency, std::chrono::duration_cast<std::chrono::duration<double> >(stop - test.foundTime));
+
+                if (test.clq > cliqueLB)
+                {
+                    cliqueLB = test.clq;
+                    clique.swap(test.clique);
+                    success = true;
+                }
+                strategy->update(test.clq, true, std::chrono::duration_cast<std::chrono::duration<double> >(test.foundTime - start).count());
+            }
+            else if (test.exhausted)
+            {
+                cliqueUB = std::min((int)cliqueUB, test.clq - 1);
+                strategy->update(test.clq, false, std::chrono::duration_cast<std::chrono::duration<double> >(stop - start).count());
+            }
+        }
+
+        if (success)
+        {
+            cache.prune(cliqueLB);
+        }
+
+        if (budgetSpent)
+        {
+            break;
+        }
+    }
+    tests.clear();
+}
+
+void Clique::collectCounters()
+{
+    wastedNodes = 0;
+    numCancelled = 0;
+    numNodes = 0;
+    numPruned = 0;
+    numSmall = 0;
+    smallNodes = 0;
+    kernelTime = std::chrono::duration<double>(0);
+    searchTime = std::chrono::duration<double>(0);
+    std::fill(numReduced, numReduced + VertexCover::numReductions, 0);
+
+    for (int t = 0; t < numThreads; t++)
+    {
+        VertexCover &VC = solvers[t];
+
+        if (statsEnabled)
+        {
+            stats[t].searchTime = VC.searchTime;
+        }
+        wastedNodes += VC.wastedNodes;
+        numCancelled += VC.numCancelled;
+        numNodes += VC.numNodes;
+        numPruned += VC.numPruned;
+        numSmall += VC.numSmall;
+        smallNodes += VC.smallNodes;
+        kernelTime += std::chrono::duration<double>(VC.kernelTime);
+        searchTime += std::chrono::duration<double>(VC.searchTime);
+        numCoreFiltered += VC.numCoreFiltered;
+        numColorFiltered += VC.numColorFiltered;
+        numKnownInfeasible += VC.numKnownInfeasible;
+        VC.wastedNodes = 0;
+        VC.numCancelled = 0;
+        VC.numNodes = 0;
+        VC.numPruned = 0;
+        VC.numSmall = 0;
+        VC.smallNodes = 0;
+        VC.kernelTime = 0;
+        VC.searchTime = 0;
+        VC.numCoreFiltered = 0;
+        VC.numColorFiltered = 0;
+        VC.numKnownInfeasible = 0;
+
+        for (int rule = 0; rule < VertexCover::numReductions; rule++)
+        {
+            numReduced[rule] += VC.numReduced[rule];
+            VC.numReduced[rule] = 0;
+        }
+    }
+
+    /**
+     * The search counters of a cluster are added over its processes. The
+     * other statistics are the ones of this process.
+     */
+    if (cluster != nullptr)
+    {
+        numNodes = cluster->sum(numNodes);
+        numPruned = cluster->sum(numPruned);
+        numSmall = cluster->sum(numSmall);
+        smallNodes = cluster->sum(smallNodes);
+        wastedNodes = cluster->sum(wastedNodes);
+    }
+}
+
+int Clique::findMaxClique()
+{
+    std::chrono::high_resolution_clock::time_point begin_time = std::chrono::high_resolution_clock::now();
+
+    /**
+     * The ordering may have been read from a snapshot. The subgraphs are
+     * generated on demand from the right neighbors of the vertices.
+     */
+    if (!graph.ordered)
+    {
+        graph.computeDegeneracyOrdering();
+    }
+
+    if (relabel)
+    {
+        graph.relabel();
+    }
+    graph.rightNeighborsFirst();
+    cache.clear();
+    cache.bitsets = (backend == bitsetBackend);
+    std::vector<std::atomic<int> >(graph.n).swap(coreBound);
+    std::vector<std::atomic<int> >(graph.n).swap(colorBound);
+
+    std::vector<std::atomic<int> >(graph.n).swap(infeasibleK);
+
+    for (int i = 0; i < graph.n; i++)
+    {
+        coreBound[i] = -1;
+        infeasibleK[i] = -1;
+    }
+    numDegreeFiltered = 0;
+    numCoreFiltered = 0;
+    numColorFiltered = 0;
+    numKnownInfeasible = 0;
+    cliqueUB = graph.cliqueUB;
+    cliqueLB = graph.cliqueLB;
+    numIterations = 0;
+    numTested = 0;
+    cancelLatency = std::chrono::duration<double>(0);
+    budgetSpent = false;
+    budgetNodes = 0;
+
+    /**
+     * The workers always get their statistics, which stay empty if they are
+     * not collected.
+     */
+    stats.assign(numThreads, workerStats());
+
+    if (statsEnabled)
+    {
+        iterationTime.clear();
+        iterationSizes.clear();
+    }
+
+    for (int t = 0; t < numThreads; t++)
+    {
+        VertexCover &VC = solvers[t];
+        VC.stats = &stats[t];
+        VC.numCoreFiltered = 0;
+        VC.numColorFiltered = 0;
+        VC.numKnownInfeasible = 0;
+        VC.reductions = reductions;
+        VC.smallSolver = smallSolver;
+        VC.sharedNodes = (nodeLimit > 0) ? &budgetNodes : nullptr;
+    }
+    heuristicTime = std::chrono::duration<double>(0);
+    heuristicLB = graph.cliqueLB;
+
+    /**
+     * The last cliqueLB vertices of the degeneracy ordering form a clique.
+     */
+    clique.assign(graph.ordering.end() - graph.cliqueLB, graph.ordering.end());
+    std::chrono::high_resolution_clock::time_point end_time = std::chrono::high_resolution_clock::now();
+    degeneracyTime = std::chrono::duration_cast<std::chrono::duration<double> >(end_time - begin_time);
+
+    if (statsEnabled)
+    {
+        stats[0].events.push_back({"degeneracy", 0, 0, degeneracyTime.count()});
+    }
+
+    /**
+     * If the upper and lower bounds are different, the vertices are sorted
+     * based on their right degree
+     */
+
+    if (cliqueLB < cliqueUB)
+    {
+        sortedList = std::vector<int>(graph.n);
+        std::vector<int> buckets(graph.d + 1, 0);
+
+        for (int i = 0; i < graph.n; i++)
+        {
+            buckets[graph.rightDegree[i]]++;
+        }
+
+        int temp;
+        int count = 0;
+
+        for (int k = graph.d; k >= 0; k--)
+        {
+            temp = buckets[k];
+            buckets[k] = count;
+            count += temp;
+        }
+
+        for (int i = 0; i < graph.n; i++)
+        {
+            sortedList[buckets[graph.rightDegree[i]]] = i;
+            buckets[graph.rightDegree[i]]++;
+        }
+
+        /**
+         * The heuristic raises the lower bound, which rules out the clique
+         * sizes up to it.
+         */
+        if (heuristicBudget > 0)
+        {
+            std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
+            CliqueHeuristic heuristic(graph, pool);
+            double budget = heuristicBudget;
+
+            /**
+             * The heuristic cannot take more than the time limit.
+             */
+            if ((timeLimit > 0) && (cluster == nullptr))
+            {
+                budget = std::min(budget, std::max(timeLimit - std::chrono::duration<double>(start - begin_time).count(), 0.0));
+            }
+            heuristicLB = heuristic.run(sortedList, cliqueLB, budget);
+
+            if (heuristicLB > cliqueLB)
+            {
+                cliqueLB = heuristicLB;
+                clique.swap(heuristic.clique);
+            }
+            heuristicTime = std::chrono::duration_cast<std::chrono::duration<double> >(std::chrono::high_resolution_clock::now() - start);
+
+            if (statsEnabled)
+            {
+                stats[0].events.push_back({"heuristic", 0, std::chrono::duration<double>(start - begin_time).count(), heuristicTime.count()});
+            }
+        }
+
+        /**
+         * The heuristic stops after a time budget, so the processes may have
+         * found different cliques. They all start from the largest one.
+         */
+        if (cluster != nullptr)
+        {
+            cliqueLB = cluster->largest(cliqueLB, clique);
+        }
+
+        searchSizes(begin_time);
+    }
+    end_time = std::chrono::high_resolution_clock::now();
+    collectCounters();
+    exact = (cliqueLB >= cliqueUB);
+    runningTime = std::chrono::duration_cast<std::chrono::duration<double> >(end_time - begin_time);
+
+    if (log == nullptr)
+    {
+        return 0;
+    }
+    *log << "Number of threads used: " << numThreads << "\n";
+
+    if (cluster != nullptr)
+    {
+        *log << "Processes used: " << cluster->size() << " (the counters of the search nodes are added over them)\n";
+    }
+    *log << "Degeneracy: " << graph.d << "\n";
+    *log << "Lower bound from degeneracy: " << graph.cliqueLB << "\n";
+    *log << "Lower bound from heuristic: " << heuristicLB << " (" << heuristicTime.count() << ")\n";
+    if (exact)
+    {
+        *log << "Maximum clique size: " << cliqueUB << "\n";
+    }
+    else
+    {
+        *log << "Maximum clique size: between " << cliqueLB << " and " << cliqueUB << " (the budget ran out)\n";
+    }
+    *log << "Total running time: " << runningTime.count() << " \n";
+    *log << "Search strategy: " << SearchStrategy::name(search) << " (" << numTested <<
+    " clique sizes tested in " << numIterations << " iterations)\n";
+    *log << "Wasted work after cancellation: " << wastedNodes << " search nodes in " <<
+    numCancelled << " abandoned subproblems (max. stop latency " << cancelLatency.count() << ")\n";
+    *log << "Subgraphs discarded: " << numDegreeFiltered << " by the right degree, " << numCoreFiltered <<
+    " by the core number, " << numColorFiltered << " by the coloring and " << numKnownInfeasible <<
+    " solved for a larger k\n";
+    *log << "Kernel time: " << kernelTime.count() << ", vertex cover search time: " << searchTime.count() <<
+    " (added over the workers)\n";
+    *log << "Search nodes: " << numNodes << " (" << numPruned << " pruned by the lower bound, " << numSmall <<
+    " solved by the small solvers in " << smallNodes << " nodes)\n";
+
+    if (statsEnabled)
+    {
+        workerStats total;
+
+        for (const workerStats &ws : stats)
+        {
+            total.merge(ws);
+        }
+        *log << "Search nodes per depth:";
+
+        for (size_t d = 0; d < total.depthNodes.size(); d++)
+        {
+            *log << " " << total.depthNodes[d] << " (" << total.depthTime[d] << ")";
+        }
+        *log << "\n";
+    }
+    *log << "Reduction and branching rules applied:";
+
+    for (int rule = 0; rule < VertexCover::numReductions; rule++)
+    {
+        *log << (rule > 0 ? ", " : " ") << numReduced[rule] << " " << VertexCover::reductionName(rule);
+    }
+    *log << "\n";
+    *log << "Subgraphs generated: " << cache.numBuilt << " (" << cache.numReused <<
+    " reused, peak cache size " << (cache.peakBytes >> 20) << " MB of " << (cache.budget >> 20) << " MB)\n";
+    *log << "-------------------------------------------------------------\n";
+
+    return 0;
+}
+
+void Clique::printResult(
+    std::ostream &out)
+{
+    out << graph.name << " " << graph.n << " " << graph.m << " " <<
+    graph.delta << " " << graph.Delta << " " <<
+    graph.readTime.count() << " " << graph.d << " " <<
+    graph.cliqueLB << " " << degeneracyTime.count() << " ";
+
+    if (exact)
+    {
+        out << cliqueUB;
+    }
+    else
+    {
+        out << cliqueLB << ".." << cliqueUB;
+    }
+    out << " " << runningTime.count() << " " << numThreads << "\n";
+}
+
+cliqueResult Clique::result()
+{
+    cliqueResult r;
+    r.omega = cliqueLB;
+    r.omegaUB = cliqueUB;
+    r.exact = exact;
+    r.d = graph.d;
+    r.degeneracyLB = graph.cliqueLB;
+    r.heuristicLB = heuristicLB;
+    r.numNodes = numNodes;
+    r.readTime = graph.readTime;
+    r.degeneracyTime = degeneracyTime;
+    r.heuristicTime = heuristicTime;
+    r.runningTime = runningTime;
+    r.kernelTime = kernelTime;
+    r.searchTime = searchTime;
+
+    for (int v : clique)
+    {
+        r.clique.push_back(graph.alias[v]);
+    }
+    return r;
+}
+
+void Clique::writeStats(
+    std::ostream &out)
+{
+    std::stringstream json;
+    json.precision(9);
+    json << "{\"traceEvents\": [";
+    bool first = true;
+
+    /**
+     * The spans of the workers, in microseconds.
+     */
+    for (int t = 0; t < (int)stats.size(); t++)
+    {
+        for (const traceEvent &event : stats[t].events)
+        {
+            json << (first ? "\n" : ",\n") << "{\"name\": \"" << event.name;
+
+            if (event.clq > 0)
+            {
+                json << " " << event.clq;
+            }
+            json << "\", \"ph\": \"X\", \"pid\": 0, \"tid\": " << t << ", \"ts\": " << 1e6 * event.begin <<
+            ", \"dur\": " << 1e6 * event.duration << "}";
+            first = false;
+        }
+    }
+    json << "\n],\n\"displayTimeUnit\": \"ms\",\n\"stats\": {";
+    json << "\"graph\": \"" << graph.name << "\", \"omega\": " << cliqueUB << ", \"threads\": " << numThreads <<
+    ", \"runningTime\": " << runningTime.count() << ",\n";
+
+    workerStats total;
+    double idleTime = 0;
+
+    for (const workerStats &ws : stats)
+    {
+        total.merge(ws);
+    }
+
+    json << "\"subgraphs\": {\"degreeFiltered\": " << numDegreeFiltered << ", \"coreFiltered\": " << numCoreFiltered <<
+    ", \"colorFiltered\": " << numColorFiltered << ", \"knownInfeasible\": " << numKnownInfeasible <<
+    ", \"built\": " << cache.numBuilt << ", \"reused\": " << cache.numReused << ", \"taken\": " << total.numSubgraphs <<
+    ", \"decidedByBuss\": " << total.numBussDecided << ", \"decidedByNT\": " << total.numNTDecided <<
+    ", \"searched\": " << total.numSearched << "},\n";
+    json << "\"kernels\": {";
+
+    for (int stage = 0; stage < 3; stage++)
+    {
+        const kernelSizes &sizes = (stage == 0) ? total.input : ((stage == 1) ? total.buss : total.nt);
+        json << ((stage > 0) ? ", " : "") << "\"" << ((stage == 0) ? "input" : ((stage == 1) ? "buss" : "nt")) <<
+        "\": {\"graphs\": " << sizes.numGraphs << ", \"vertices\": " << sizes.vertices << ", \"edges\": " << sizes.edges <<
+        ", \"maxVertices\": " << sizes.maxVertices << "}";
+    }
+    json << "},\n";
+    json << "\"search\": {\"nodes\": " << numNodes << ", \"pruned\": " << numPruned << ", \"small\": " << numSmall <<
+    ", \"smallNodes\": " << smallNodes << ", \"maxDepth\": " <<
+    (int)total.depthNodes.size() - 1 << ", \"nodesPerDepth\": [";
+
+    for (size_t d = 0; d < total.depthNodes.size(); d++)
+    {
+        json << ((d > 0) ? ", " : "") << total.depthNodes[d];
+    }
+    json << "]},\n";
+    json << "\"time\": {\"degeneracy\": " << degeneracyTime.count() << ", \"heuristic\": " << heuristicTime.count() <<
+    ", \"subgraphs\": " << total.subgraphTime << ", \"buss\": " << total.bussTime << ", \"nt\": " << total.ntTime <<
+    ", \"search\": " << searchTime.count() << "},\n";
+    json << "\"iterations\": [";
+
+    for (size_t i = 0; i < iterationTime.size(); i++)
+    {
+        json << ((i > 0) ? ", " : "") << "{\"sizes\": [";
+
+        for (size_t g = 0; g < iterationSizes[i].size(); g++)
+        {
+            json << ((g > 0) ? ", " : "") << iterationSizes[i][g];
+        }
+        json << "], \"time\": " << iterationTime[i] << "}";
+    }
+    json << "],\n";
+
+    /**
+     * A worker is idle from the moment it stops until the last worker of the
+     * iteration stops.
+     */
+    json << "\"workers\": [";
+
+    for (int t = 0; t < (int)stats.size(); t++)
+    {
+        const workerStats &ws = stats[t];
+        double busy = 0;
+        double idle = 0;
+
+        for (size_t i = 0; i < ws.busyTime.size(); i++)
+        {
+            busy += ws.busyTime[i];
+            idle += std::max(iterationTime[i] - ws.busyTime[i], 0.0);
+        }
+        idleTime += idle;
+        json << ((t > 0) ? ",\n" : "\n") << "{\"busy\": " << busy << ", \"idle\": " << idle << ", \"subgraphs\": " <<
+        ws.numSubgraphs << ", \"subgraphTime\": " << ws.subgraphTime << ", \"bussTime\": " << ws.bussTime <<
+        ", \"ntTime\": " << ws.ntTime << ", \"searchTime\": " << ws.searchTime << "}";
+    }
+    json << "\n], \"idleTime\": " << idleTime << "}}\n";
+    out << json.str();
+}
+
+void Clique::printClique(
+    std::ostream &out)
+{
+    for (size_t i = 0; i < clique.size(); i++)
+    {
+        out << (i > 0 ? " " : "") << graph.alias[clique[i]];
+    }
+    out << "\n";
+}
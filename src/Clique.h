@@ -0,0 +1,426 @@
+/**
+ *
+ * @file Clique.h
+ * @brief Finds The maximum clique of a graph.
+ *
+ * @details This code implements an efficient algorithm for the maximum clique
+ * problem that runs in time polynomial in the graph's size, but exponential
+ * in the difference $d-\omega$ (where $d$ denotes the graph's degeneracy).
+ * When this difference is a constant, the running time is ${O}(dm)={O}(m^{1.5})$.
+ * Since 70% of common test instances have $d-\omega \le 3$, our implementation
+ * performs rather well and is competitive with previous approaches.
+ * Key subroutines in our approach include existing kernelization and
+ * fixed-parameter tractable algorithms for vertex cover.
+ *
+ * Please cite the following paper if used:
+ * Jose L. Walteros and Austin L. Buchanan. Why is maximum clique easy in practice?
+ *
+ * @author Jose L. Walteros
+ *
+ * @version   1.0
+ * @date      January 2018
+ *
+ * Copyright (C) 2018 Jose L. Walteros. All rights reserved.
+ *
+ *---+----+----+----+----+----+----+----+----+----+----+----+----+----+----+----*/
+#ifndef _CLIQUE_H_
+#define _CLIQUE_H_
+
+#include <math.h>
+#include <chrono>
+#include <atomic>
+#include <memory>
+#include <iostream>
+#include <vector>
+#include "Graph.h"
+#include "VertexCover.h"
+#include "ThreadPool.h"
+#include "SubgraphCache.h"
+#include "SearchStrategy.h"
+#include "Scheduler.h"
+#include "NeighborhoodGraph.h"
+#include "NemhauserTrotter.h"
+#include "SolverContext.h"
+#include "SearchStats.h"
+#include "Cluster.h"
+
+/**
+ * Test of a clique size, run by a group of consecutive workers of the pool.
+ */
+struct sizeTest
+{
+    int clq; /**< Clique size tested */
+    int firstWorker; /**< First worker of the group */
+    int numWorkers; /**< Workers in the group */
+    std::unique_ptr<Scheduler> scheduler; /**< Scheduler of the group */
+    std::atomic<bool> stop; /**< Cancels the work of the group */
+    std::atomic<bool> found; /**< Whether a clique of size clq was found */
+    std::atomic<bool> abandoned; /**< Whether the test was stopped because its
+    * outcome is implied by the one of another group */
+    std::atomic<int> running; /**< Workers of the group that have not finished */
+    bool exhausted; /**< Whether the group processed all its work without finding
+    * a clique, i.e., the graph has no clique of size clq */
+    std::vector<int> clique; /**< Clique found */
+    std::chrono::high_resolution_clock::time_point foundTime; /**< When the
+    * clique was found */
+};
+
+/**
+ * Result of a run of @see Clique::findMaxClique.
+ */
+struct cliqueResult
+{
+    int omega; /**< Size of the maximum clique (of the clique found if the run
+    * was not exact) */
+    int omegaUB; /**< Upper bound of the size of the maximum clique, which is
+    * omega if the run was exact */
+    bool exact; /**< Whether the budget of the run was enough to find omega */
+    std::vector<int> clique; /**< Names of the vertices of a maximum clique */
+    int d; /**< Degeneracy */
+    int degeneracyLB; /**< Lower bound from the degeneracy ordering */
+    int heuristicLB; /**< Lower bound from the clique heuristic */
+    long long numNodes; /**< Search nodes of the vertex cover problems */
+    std::chrono::duration<double> readTime; /**< Time to read or build the graph */
+    std::chrono::duration<double> degeneracyTime; /**< Degeneracy running time */
+    std::chrono::duration<double> heuristicTime; /**< Clique heuristic running time */
+    std::chrono::duration<double> runningTime; /**< Total running time */
+    std::chrono::duration<double> kernelTime; /**< Time of the Buss and NT
+    * kernels, added over the workers */
+    std::chrono::duration<double> searchTime; /**< Time of the vertex cover
+    * search, added over the workers */
+};
+
+class Clique
+{
+public:
+    /**
+     * Representation of the subgraphs used by the vertex cover search.
+     */
+    enum vcBackend
+    {
+        listBackend, /**< Adjacency lists with the Buss and NT kernels */
+        bitsetBackend /**< Bitset rows (@see BitsetVertexCover) */
+    };
+
+    /**
+     * Upper bounds tested before the complement subgraph of a vertex v is
+     * generated (@see Clique::filterVertex).
+     */
+    enum ubFilter
+    {
+        noFilter, /**< Only the right degree of v */
+        coreFilter, /**< Largest core number of G[N+(v)] */
+        coloringFilter /**< Core number and greedy coloring of G[N+(v)] */
+    };
+
+    static const int budgetPollMicroseconds = 1000; /**< Time between two checks
+    * of the budget while the workers search */
+    int numThreads; /**< Number of threads to use in the run */
+    std::ostream *log = &std::clog; /**< Stream that receives the summary of the run
+    * (none if null) */
+    int chunkSize = 4; /**< Number of vertices of the sorted list that a thread
+    * takes at a time (@see Scheduler) */
+    vcBackend backend = listBackend; /**< Backend of the vertex cover search */
+    bool undoLog = false; /**< Whether the vertex cover problems given as
+    * adjacency lists are solved in place (@see UndoVertexCover) instead of
+    * copying the graph of every branch (@see VertexCover::kVertexCover) */
+    double heuristicBudget = 1.0; /**< Seconds the clique heuristic can take before
+    * the exact search (@see CliqueHeuristic); 0 disables it */
+    double timeLimit = 0; /**< Seconds the run can take; once they are spent,
+    * the search stops with the bounds proven so far (0: no limit) */
+    long long nodeLimit = 0; /**< Search nodes the run can explore, counted
+    * every VertexCover::nodeBatch nodes of a worker; once they are spent, the
+    * search stops with the bounds proven so far (0: no limit) */
+    unsigned reductions = VertexCover::defaultReductions; /**< Rules of the vertex cover
+    * search applied besides the degree rules (@see VertexCover::reductions) */
+    ubFilter filter = coloringFilter; /**< Upper bounds tested before generating
+    * the subgraphs */
+    SearchStrategy::kind search = SearchStrategy::linear; /**< Strategy that
+    * picks the clique sizes tested (@see SearchStrategy) */
+    bool smallSolver = true; /**< Whether the small nodes of the vertex cover
+    * search are solved by SmallVertexCover (@see VertexCover::smallSolver) */
+    Cluster *cluster = nullptr; /**< Processes that share the search, which
+    * must all run it on the same graph with the same options (none if it
+    * runs in a single process) */
+    bool relabel = false; /**< Whether the vertices of the graph are renamed by
+    * their position in the ordering before the search (@see Graph::relabel) */
+    bool exact = true; /**< Whether the last run found the size of the maximum
+    * clique, or its budget ran out and cliqueLB and cliqueUB only bound it
+    * (the budgets are only applied in a single process) */
+    std::atomic<bool> budgetSpent; /**< Whether the budget of the run ran out */
+    std::atomic<long long> budgetNodes; /**< Search nodes of the run, as counted
+    * for the node limit */
+    std::atomic<int> cliqueLB;  /**< Lower bound of max clique */
+    std::atomic<int> cliqueUB; /**< Upper bound of max clique */
+    std::atomic<int> subgraphClique; /**< subgraph that has a maximum clique */
+    std::vector<int> clique; /**< Vertices of the largest clique found so far */
+    std::vector<int> sortedList; /**< List of vertices sorted by their right degree */
+    Graph &graph; /**< Graph */
+    SubgraphCache cache; /**< Subgraphs induced by closed right neighborhood of
+    * the vertices, generated when they are first processed */
+    std::chrono::duration<double> degeneracyTime; /**< Degeneracy running time */
+    std::chrono::duration<double> heuristicTime; /**< Clique heuristic running time */
+    int heuristicLB; /**< Size of the clique found by the heuristic (or the lower
+    * bound from degeneracy if it found none larger) */
+    std::chrono::duration<double> runningTime; /**< Total running time */
+    std::chrono::duration<double> cancelLatency; /**< Longest time a worker took to
+    * stop after another one found a clique */
+    long long wastedNodes; /**< Search nodes explored in subproblems abandoned
+    * after a clique was found */
+    int numCancelled; /**< Subproblems abandoned after a clique was found */
+    long long numNodes; /**< Search nodes of the vertex cover problems */
+    long long numPruned; /**< Search nodes pruned by the lower bound */
+    long long numSmall; /**< Search nodes solved by SmallVertexCover */
+    long long smallNodes; /**< Nodes of the recursions of SmallVertexCover */
+    std::chrono::duration<double> kernelTime; /**< Time spent in the Buss and NT
+    * kernels, added over the workers */
+    std::chrono::duration<double> searchTime; /**< Time spent in the vertex cover
+    * search, added over the workers */
+    long long numReduced[VertexCover::numReductions]; /**< Times every reduction
+    * rule of the vertex cover search was applied */
+    std::vector<NeighborhoodGraph> neighborhoods; /**< G[N+(v)] of each worker,
+    * used by the filters */
+    std::vector<std::atomic<int> > coreBound; /**< Largest core number + 2 of
+    * G[N+(v)] for every vertex v (-1 until it is computed) */
+    std::vector<std::atomic<int> > colorBound; /**< Number of colors + 1 of
+    * G[N+(v)] for every vertex v */
+    long long numDegreeFiltered; /**< Subgraphs skipped by the right degree,
+    * over all the clique sizes tested */
+    long long numCoreFiltered; /**< Subgraphs discarded by the core number,
+    * added over the workers */
+    long long numColorFiltered; /**< Subgraphs discarded by the coloring, added
+    * over the workers */
+    std::vector<std::atomic<int> > infeasibleK; /**< Largest k for which the
+    * subgraph of every vertex was proven to have no vertex cover (-1 if none) */
+    long long numKnownInfeasible; /**< Subgraphs skipped because they had no
+    * vertex cover for a larger k, added over the workers */
+    int numIterations; /**< Iterations of the search */
+    int numTested; /**< Clique sizes tested, including the abandoned ones */
+    std::unique_ptr<SolverContext> ownContext; /**< Context created by the
+    * constructor that does not receive one */
+    SolverContext &context; /**< Workers and scratch data of the run */
+    ThreadPool &pool; /**< Workers, created once and reused for every clique size */
+    std::vector<VertexCover> &solvers; /**< Vertex cover solver of each worker. They
+    * keep their scratch data between clique sizes */
+    std::vector<ntWorkspace> &ntWorkspaces; /**< Arrays of the NT kernels of each
+    * worker */
+    std::vector<sizeTest> tests; /**< Clique sizes tested in the current iteration */
+    std::vector<std::chrono::high_resolution_clock::time_point> stopTimes; /**< When
+    * each worker stopped processing its clique size */
+    std::vector<workerStats> stats; /**< Statistics of each worker (only if
+    * statsEnabled, @see SearchStats.h) */
+    std::vector<std::vector<int> > iterationSizes; /**< Clique sizes tested in
+    * every iteration (only if statsEnabled) */
+    std::vector<double> iterationTime; /**< Seconds taken by every iteration
+    * (only if statsEnabled) */
+
+    /**
+     * Clique object constuctor.
+     *
+     * @param[in] graph: The graph.
+     * @param[in] numThreads : Number of threads to be used in the run.
+     */
+    Clique(
+        Graph &graph,
+        const int numThreads);
+
+    /**
+     * Clique object constuctor that runs on the workers of an existing context,
+     * which keeps them for the next graphs.
+     *
+     * @param[in] graph: The graph.
+     * @param[in] context : Workers and scratch data (not used by another run
+     * at the same time).
+     */
+    Clique(
+        Graph &graph,
+        SolverContext &context);
+
+    /**
+     * findMaxClique: The procedure finds the size of the max clique of the graph
+     */
+    int findMaxClique();
+
+    /**
+     * Tests the clique sizes between cliqueLB and cliqueUB picked by the search
+     * strategy on the vertices of the sorted list, which must be sorted by
+     * decreasing right degree, until both bounds meet or the budget runs out.
+     * The cache and the bounds of the vertices found by earlier tests are
+     * reused.
+     *
+     * @param[in] begin_time : Beginning of the run, for the statistics and the
+     * time limit.
+     */
+    void searchSizes(
+        std::chrono::high_resolution_clock::time_point begin_time);
+
+    /**
+     * Adds the search counters and times of the workers to the ones of the run,
+     * and resets them. The counters of the filters keep adding up until the
+     * next Clique::findMaxClique.
+     */
+    void collectCounters();
+
+    /**
+     * Writes the result line of the run:
+     *
+     * <filename n m delta Delta readTime d cliqueLB degeneracyTime omega
+     * runningTime numThreads>
+     *
+     * If the budget ran out, omega is written as lower..upper, the bounds
+     * proven.
+     */
+    void printResult(
+        std::ostream &out);
+
+    /**
+     * Result of the last run.
+     */
+    cliqueResult result();
+
+    /**
+     * Writes the statistics of the last run (@see SearchStats.h) as a Chrome
+     * trace file: the spans of the workers are its trace events, and the
+     * counters, kernel sizes, times and the busy and idle time of every worker
+     * are in its "stats" member. The statistics are only collected if
+     * statsEnabled.
+     */
+    void writeStats(
+        std::ostream &out);
+
+    /**
+     * Writes the names of the vertices of the maximum clique in a single line.
+     */
+    void printClique(
+        std::ostream &out);
+
+    /**
+     * Processes the subgraphs handed out by the scheduler of the test, and the
+     * tasks published by the workers of its group, until there is no work left
+     * or the test is stopped. The last worker of the group to finish records
+     * whether the test was exhausted.
+     *
+     * @param[in] test : Clique size tested by the group of the worker.
+     * @param[in] threadNumber : Worker that runs the procedure.
+     */
+    void processSubgraphs(
+        sizeTest &test,
+        int threadNumber);
+
+    /**
+     * Tests whether the subgraph of vertex v has a clique of size clq, using
+     * the Buss and NT kernels and the vertex cover search.
+     *
+     * @returns -1 if v and the vertices after it in the sorted list cannot have
+     * such a clique, 1 if the subgraph has one and 0 otherwise.
+     */
+    int processVertex(
+        VertexCover &VC,
+        NeighborhoodGraph &nG,
+        ntWorkspace &ntWS,
+        workerStats &stats,
+        int v,
+        int clq);
+
+    /**
+     * Upper bound filter of v: whether the core number or the coloring of
+     * G[N+(v)] proves that no clique of size clq starts at v. Both bounds are
+     * computed the first time v is tested and kept for the following sizes.
+     *
+     * @param[in] VC : Vertex cover solver of the worker, which counts the
+     * subgraphs discarded.
+     * @param[in] nG : Scratch graph of the worker.
+     * @param[in] v : Vertex.
+     * @param[in] clq : Clique size being tested.
+     *
+     * @returns true if v is discarded.
+     */
+    bool filterVertex(
+        VertexCover &VC,
+        NeighborhoodGraph &nG,
+        int v,
+        int clq);
+
+    /**
+     * Solves the vertex cover problem of the subgraph sG with the list backend.
+     *
+     * @returns 1 if there is a vertex cover of size k and -1 otherwise.
+     */
+    int processLists(
+        VertexCover &VC,
+        ntWorkspace &ntWS,
+        workerStats &stats,
+        subgraph &sG,
+        int k);
+
+    /**
+     * Finds if a graph given as adjacency lists has a vertex cover of size k,
+     * with the branching selected by Clique::undoLog.
+     */
+    bool solveVertexCover(
+        VertexCover &VC,
+        int n,
+        int k,
+        std::vector<vertex> &vertices,
+        std::vector<std::vector<int> > &adjLists);
+
+    /**
+     * Solves a vertex cover subproblem published by a worker.
+     */
+    void processTask(
+        VertexCover &VC,
+        sizeTest &test,
+        vcTask &task);
+
+    /**
+     * Marks the test as found, which cancels the work of the other workers of
+     * its group, and abandons the tests of smaller sizes. The first worker that
+     * succeeds records the time and the clique, i.e., the vertices of the
+     * subgraph of VC.root that are not in the vertex cover VC.cover.
+     */
+    void signalClique(
+        VertexCover &VC,
+        sizeTest &test);
+
+    /**
+     * Run by a thread of its own while the workers test the clique sizes of
+     * an iteration shared with other processes: polls the flags of the
+     * cluster until finished is set, and stops the tests whose outcome is
+     * known elsewhere (@see Cluster).
+     */
+    void pollCluster(
+        const std::atomic<bool> &finished);
+
+    /**
+     * Whether the time limit (counted from begin_time) or the node limit of
+     * the run has been reached.
+     */
+    bool overBudget(
+        std::chrono::high_resolution_clock::time_point begin_time);
+
+    /**
+     * Run by a thread of its own while the workers test the clique sizes of
+     * an iteration with a budget: checks the budget until finished is set,
+     * and stops all the tests once it runs out.
+     */
+    void watchBudget(
+        std::chrono::high_resolution_clock::time_point begin_time,
+        const std::atomic<bool> &finished);
+
+    /**
+     * Called by every process at the end of an iteration shared with other
+     * processes: sets whether every test was found or exhausted by any of the
+     * processes, and gives the test of the largest clique found the vertices
+     * of that clique.
+     */
+    void shareOutcomes();
+
+    /**
+     * Abandons the tests of the current iteration whose clique size is larger
+     * (or smaller) than clq.
+     */
+    void abandonTests(
+        int clq,
+        bool larger);
+};
+#endif // _CLIQUE_H_
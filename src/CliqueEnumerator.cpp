@@ -0,0 +1,318 @@
+/**@file CliqueEnumerator.cpp
+ *
+ * @brief Enumerates the maximum cliques of a graph, or its largest maximal
+ * cliques.
+ *
+ * @author Jose L. Walteros
+ *
+ * @version   1.0
+ * @date      June 2018
+ *
+ * Copyright (C) 2018 Jose L. Walteros. All rights reserved.
+ *
+ *---+----+----+----+----+----+----+----+----+----+----+----+----+----+----+----*/
+#include <algorithm>
+#include "CliqueEnumerator.h"
+#include "Bitset.h"
+
+void CliqueEnumerator::run()
+{
+    std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
+    Graph &graph = clique.graph;
+    int omega = clique.cliqueLB;
+    cliques.clear();
+    numFound = 0;
+    numSearched = 0;
+
+    /**
+     * The search only sorts the vertices if the bounds of the degeneracy
+     * ordering differ.
+     */
+    std::vector<int> order = clique.sortedList;
+
+    if ((int)order.size() != graph.n)
+    {
+        order.resize(graph.n);
+
+        for (int i = 0; i < graph.n; i++)
+        {
+            order[i] = i;
+        }
+        std::stable_sort(order.begin(), order.end(), [&graph](int a, int b) { return graph.rightDegree[a] > graph.rightDegree[b]; });
+    }
+    std::vector<workspace> spaces(clique.numThreads);
+
+    for (int clq = omega; clq >= 1; clq--)
+    {
+        if ((limit == 0) ? (clq < omega) : (numFound >= limit))
+        {
+            break;
+        }
+        smallestSize = clq;
+        bool maximal = (limit > 0) && (clq < omega);
+        std::atomic<int> cursor(0);
+
+        clique.pool.run([&](int t)
+        {
+            workspace &ws = spaces[t];
+
+            while ((limit == 0) || (numFound < limit))
+            {
+                int i = cursor.fetch_add(1);
+
+                /**
+                 * The right degrees decrease along the sorted list.
+                 */
+                if ((i >= graph.n) || (graph.rightDegree[order[i]] + 1 < clq))
+                {
+                    break;
+                }
+                int v = order[i];
+
+                if (clique.processVertex(clique.solvers[t], clique.neighborhoods[t], clique.ntWorkspaces[t], clique.stats[t], v, clq) == 1)
+                {
+                    numSearched++;
+                    enumerate(v, clq, maximal, clique.neighborhoods[t], ws);
+                }
+            }
+        });
+
+        for (workspace &ws : spaces)
+        {
+            for (std::vector<int> &vertices : ws.found)
+            {
+                cliques.push_back(std::move(vertices));
+            }
+            ws.found.clear();
+        }
+    }
+
+    std::sort(cliques.begin(), cliques.end(), [](const std::vector<int> &a, const std::vector<int> &b)
+    {
+        return (a.size() != b.size()) ? (a.size() > b.size()) : (a < b);
+    });
+
+    if ((limit > 0) && ((long long)cliques.size() > limit))
+    {
+        cliques.resize(limit);
+    }
+    runningTime = std::chrono::duration_cast<std::chrono::duration<double> >(std::chrono::high_resolution_clock::now() - start);
+
+    if (clique.log != nullptr)
+    {
+        *clique.log << "Cliques enumerated: " << cliques.size() << " of sizes " << omega << " to " << smallestSize <<
+        " (" << numSearched << " subgraphs searched) in " << runningTime.count() << "\n";
+    }
+}
+
+void CliqueEnumerator::print(
+    std::ostream &out)
+{
+    for (const std::vector<int> &vertices : cliques)
+    {
+        for (size_t i = 0; i < vertices.size(); i++)
+        {
+            out << (i > 0 ? " " : "") << vertices[i];
+        }
+        out << "\n";
+    }
+}
+
+void CliqueEnumerator::enumerate(
+    int v,
+    int clq,
+    bool maximal,
+    NeighborhoodGraph &nG,
+    workspace &ws)
+{
+    nG.build(v);
+    int n = nG.n;
+    int words = Bitset::numWords(n);
+    ws.words = words;
+    ws.rows.assign((size_t)n * words, 0);
+
+    for (int i = 0; i < n; i++)
+    {
+        for (int j : nG.adjLists[i])
+        {
+            Bitset::set(ws.rows.data() + (size_t)i * words, j);
+        }
+    }
+
+    /**
+     * The candidates of depth 0 are all the right neighbors of v.
+     */
+    ws.candidates.assign((size_t)clq * words, 0);
+    ws.uncolored.assign(2 * words, 0);
+
+    for (int i = 0; i < n; i++)
+    {
+        Bitset::set(ws.candidates.data(), i);
+    }
+    ws.members.clear();
+    extend(v, clq - 1, maximal, nG, ws);
+}
+
+void CliqueEnumerator::extend(
+    int v,
+    int target,
+    bool maximal,
+    NeighborhoodGraph &nG,
+    workspace &ws)
+{
+    int depth = ws.members.size();
+    int words = ws.words;
+
+    if (depth == target)
+    {
+        if ((!maximal || isMaximal(v, nG, ws)) && ((limit == 0) || (numFound < limit)))
+        {
+            std::vector<int> vertices(1, clique.graph.alias[v]);
+
+            for (int u : ws.members)
+            {
+                vertices.push_back(clique.graph.alias[nG.vertices[u]]);
+            }
+            std::sort(vertices.begin(), vertices.end());
+            ws.found.push_back(std::move(vertices));
+            numFound++;
+        }
+        return;
+    }
+    const uint64_t *candidates = ws.candidates.data() + (size_t)depth * words;
+    int remaining = 0;
+
+    for (int w = 0; w < words; w++)
+    {
+        remaining += Bitset::popcount(candidates[w]);
+    }
+
+    /**
+     * The clique needs target - depth more vertices, which have different
+     * colors in any coloring of the candidates.
+     */
+    if ((depth + remaining < target) || (colors(candidates, target - depth, ws) < target - depth))
+    {
+        return;
+    }
+    uint64_t *next = ws.candidates.data() + (size_t)(depth + 1) * words;
+
+    for (int u = Bitset::next(candidates, candidates, words, 0); u != -1; u = Bitset::next(candidates, candidates, words, u + 1))
+    {
+        if ((depth + remaining < target) || ((limit > 0) && (numFound >= limit)))
+        {
+            return;
+        }
+        remaining--;
+
+        /**
+         * The next vertices are taken after u, so every clique is found once.
+         */
+        const uint64_t *row = ws.rows.data() + (size_t)u * words;
+
+        for (int w = 0; w < words; w++)
+        {
+            uint64_t after = (w < (u >> 6)) ? 0 : ((w > (u >> 6)) ? ~uint64_t(0) : ((~uint64_t(0) << (u & 63)) << 1));
+            next[w] = candidates[w] & row[w] & after;
+        }
+        ws.members.push_back(u);
+        extend(v, target, maximal, nG, ws);
+        ws.members.pop_back();
+    }
+}
+
+bool CliqueEnumerator::isMaximal(
+    int v,
+    NeighborhoodGraph &nG,
+    workspace &ws)
+{
+    Graph &graph = clique.graph;
+    int words = ws.words;
+
+    /**
+     * A right neighbor of v adjacent to all the members (which are not
+     * adjacent to themselves) extends the clique.
+     */
+    if (ws.members.empty())
+    {
+        if (nG.n > 0)
+        {
+            return false;
+        }
+    }
+    else
+    {
+        for (int w = 0; w < words; w++)
+        {
+            uint64_t common = ~uint64_t(0);
+
+            for (int u : ws.members)
+            {
+                common &= ws.rows[(size_t)u * words + w];
+            }
+
+            if (common != 0)
+            {
+                return false;
+            }
+        }
+    }
+
+    /**
+     * So does a left neighbor of v adjacent to all the members, which comes
+     * before them in the ordering too. The left neighbors of every vertex
+     * follow its right neighbors, sorted.
+     */
+    for (int j = graph.EdgesBegin[v] + graph.rightDegree[v]; j < graph.EdgesBegin[v] + graph.degree[v]; j++)
+    {
+        int w = graph.EdgeTo[j];
+        bool extends = true;
+
+        for (size_t i = 0; (i < ws.members.size()) && extends; i++)
+        {
+            int u = nG.vertices[ws.members[i]];
+            const int *left = graph.EdgeTo.data() + graph.EdgesBegin[u];
+            extends = std::binary_search(left + graph.rightDegree[u], left + graph.degree[u], w);
+        }
+
+        if (extends)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+int CliqueEnumerator::colors(
+    const uint64_t *set,
+    int bound,
+    workspace &ws)
+{
+    int words = ws.words;
+    uint64_t *uncolored = ws.uncolored.data();
+    uint64_t *available = uncolored + words;
+    std::copy(set, set + words, uncolored);
+    int numColors = 0;
+
+    /**
+     * Every color class is an independent set taken greedily from the
+     * uncolored vertices.
+     */
+    while ((numColors < bound) && (Bitset::next(uncolored, uncolored, words, 0) != -1))
+    {
+        numColors++;
+        std::copy(uncolored, uncolored + words, available);
+
+        for (int u = Bitset::next(available, available, words, 0); u != -1; u = Bitset::next(available, available, words, u + 1))
+        {
+            Bitset::reset(uncolored, u);
+            const uint64_t *row = ws.rows.data() + (size_t)u * words;
+
+            for (int w = 0; w < words; w++)
+            {
+                available[w] &= ~row[w];
+            }
+        }
+    }
+    return numColors;
+}
@@ -0,0 +1,139 @@
+/**@file CliqueEnumerator.h
+ *
+ * @brief Enumerates the maximum cliques of a graph, or its largest maximal
+ * cliques, after Clique::findMaxClique has found the clique number.
+ *
+ * @details Every clique of G has a single first vertex v in the degeneracy
+ * ordering, and the other vertices are a clique of G[N+(v)]. The cliques of
+ * size s are therefore enumerated vertex by vertex, each one from its first
+ * vertex only, so the workers never produce the same clique twice:
+ *
+ * - Only the vertices whose right degree is at least s - 1 are visited, in the
+ *   order of the sorted list of the search.
+ * - The test of the search (@see Clique::processVertex) decides with the
+ *   filters, the kernels and the vertex cover search whether G[v] has a clique
+ *   of size s, and it reuses the bounds, the subgraphs and the infeasible
+ *   sizes that the search left behind. Most vertices stop here.
+ * - The cliques of size s - 1 of G[N+(v)] are enumerated by a recursion over
+ *   the bitset rows of G[N+(v)], which is pruned by the number of candidates
+ *   and by a greedy coloring of them.
+ *
+ * All the maximum cliques are enumerated by default. With a limit of k, the
+ * sizes are visited from the clique number down and only the maximal cliques
+ * are kept (a clique of size s < omega is maximal if no vertex of G, on either
+ * side of v, is adjacent to all of it), until k of them have been found. The
+ * workers stop as soon as they have k cliques, so when there are more than k
+ * maximal cliques of the smallest size reached, the ones kept depend on the
+ * run.
+ *
+ * The cliques are sorted by decreasing size and then by the names of their
+ * vertices, which are sorted as well.
+ *
+ * @author Jose L. Walteros
+ *
+ * @version   1.0
+ * @date      June 2018
+ *
+ * Copyright (C) 2018 Jose L. Walteros. All rights reserved.
+ *
+ *---+----+----+----+----+----+----+----+----+----+----+----+----+----+----+----*/
+#ifndef _CLIQUEENUMERATOR_H_
+#define _CLIQUEENUMERATOR_H_
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+#include "Clique.h"
+#include "NeighborhoodGraph.h"
+
+class CliqueEnumerator
+{
+public:
+    Clique &clique; /**< Search that found the clique number */
+    long long limit = 0; /**< Largest maximal cliques kept (0: all the maximum
+    * cliques) */
+    std::vector<std::vector<int> > cliques; /**< Names of the vertices of the
+    * cliques found */
+    std::atomic<long long> numFound; /**< Cliques found */
+    std::atomic<long long> numSearched; /**< Subgraphs whose cliques were
+    * enumerated, over all the sizes */
+    int smallestSize = 0; /**< Smallest clique size visited */
+    std::chrono::duration<double> runningTime; /**< Running time */
+
+    /**
+     * CliqueEnumerator constructor.
+     *
+     * @param[in] clique : Search whose Clique::findMaxClique has run.
+     */
+    inline CliqueEnumerator(
+        Clique &clique) : clique(clique), numFound(0), numSearched(0) {}
+
+    /**
+     * Enumerates the cliques, which are written to CliqueEnumerator::cliques.
+     */
+    void run();
+
+    /**
+     * Writes the names of the vertices of every clique in a line.
+     */
+    void print(
+        std::ostream &out);
+
+private:
+    /**
+     * Scratch data of a worker.
+     */
+    struct workspace
+    {
+        int words = 0; /**< Words of the rows */
+        std::vector<uint64_t> rows; /**< Adjacency matrix of G[N+(v)] */
+        std::vector<uint64_t> candidates; /**< Candidates of every depth */
+        std::vector<uint64_t> uncolored; /**< Scratch sets of the coloring */
+        std::vector<int> members; /**< Local vertices of the current clique */
+        std::vector<std::vector<int> > found; /**< Cliques found by the worker */
+    };
+
+    /**
+     * Enumerates the cliques of size clq whose first vertex is v, which must
+     * be maximal in G if maximal is set.
+     */
+    void enumerate(
+        int v,
+        int clq,
+        bool maximal,
+        NeighborhoodGraph &nG,
+        workspace &ws);
+
+    /**
+     * Node of the recursion of CliqueEnumerator::enumerate: extends the
+     * members of the workspace with the candidates of depth members.size(),
+     * up to size target.
+     */
+    void extend(
+        int v,
+        int target,
+        bool maximal,
+        NeighborhoodGraph &nG,
+        workspace &ws);
+
+    /**
+     * Whether the clique {v} + members, with the members as local vertices of
+     * G[N+(v)], cannot be extended with another vertex of G.
+     */
+    bool isMaximal(
+        int v,
+        NeighborhoodGraph &nG,
+        workspace &ws);
+
+    /**
+     * Number of colors of a greedy coloring of a set of local vertices, stopped
+     * once it reaches bound.
+     */
+    int colors(
+        const uint64_t *set,
+        int bound,
+        workspace &ws);
+};
+#endif // _CLIQUEENUMERATOR_H_
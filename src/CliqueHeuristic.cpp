@@ -0,0 +1,182 @@
+/**@file CliqueHeuristic.cpp
+ *
+ * @brief Greedy and local search heuristic that finds large cliques before the
+ * exact search starts.
+ *
+ * @author Jose L. Walteros
+ *
+ * @version   1.0
+ * @date      June 2018
+ *
+ * Copyright (C) 2018 Jose L. Walteros. All rights reserved.
+ *
+ *---+----+----+----+----+----+----+----+----+----+----+----+----+----+----+----*/
+#include <algorithm>
+#include <chrono>
+#include <vector>
+#include "CliqueHeuristic.h"
+
+int CliqueHeuristic::run(
+    const std::vector<int> &sortedList,
+    int cliqueLB,
+    double budget)
+{
+    best = cliqueLB;
+    clique.clear();
+    numSearched = 0;
+    expired = false;
+    std::chrono::high_resolution_clock::time_point deadline = std::chrono::high_resolution_clock::now() +
+        std::chrono::duration_cast<std::chrono::high_resolution_clock::duration>(std::chrono::duration<double>(budget));
+    std::atomic<int> cursor(0);
+    int numVertices = sortedList.size();
+
+    pool.run([&](int)
+    {
+        workspace ws(graph);
+
+        while (!expired)
+        {
+            int i = cursor.fetch_add(1);
+
+            /**
+             * The right degrees decrease along the sorted list, so once a
+             * vertex cannot improve the best clique, no vertex after it can.
+             */
+            if ((i >= numVertices) || (graph.rightDegree[sortedList[i]] + 1 <= best))
+            {
+                break;
+            }
+
+            if (std::chrono::high_resolution_clock::now() >= deadline)
+            {
+                expired = true;
+                break;
+            }
+            search(sortedList[i], ws);
+            numSearched++;
+        }
+    });
+    return best;
+}
+
+void CliqueHeuristic::search(
+    int v,
+    workspace &ws)
+{
+    NeighborhoodGraph &nG = ws.nG;
+    nG.build(v);
+    int p = nG.n;
+    int maxCore = nG.coreNumbers();
+
+    /**
+     * A clique of G[N+(v)] has at most maxCore + 1 vertices.
+     */
+    if (maxCore + 2 > best)
+    {
+        ws.count.assign(p, 0);
+        ws.inClique.assign(p, false);
+        ws.mark.assign(p, 0);
+        ws.stamp = 0;
+        ws.members.clear();
+
+        /**
+         * Greedy clique: the vertices peeled last have the largest core
+         * numbers.
+         */
+        for (int i = p - 1; i >= 0; i--)
+        {
+            int u = nG.order[i];
+
+            if (ws.count[u] == (int)ws.members.size())
+            {
+                add(ws, u);
+            }
+        }
+
+        for (int round = 0; round < swapRounds; round++)
+        {
+            bool improved = false;
+
+            for (int u = 0; u < p; u++)
+            {
+                if (ws.inClique[u] || (ws.count[u] + 1 != (int)ws.members.size()))
+                {
+                    continue;
+                }
+
+                /**
+                 * 1-swap: u replaces the only vertex w of the clique that is
+                 * not adjacent to it. The vertices that can then extend the
+                 * clique are neighbors of u.
+                 */
+                ws.stamp++;
+
+                for (int x : nG.adjLists[u])
+                {
+                    ws.mark[x] = ws.stamp;
+                }
+                int w = *std::find_if(ws.members.begin(), ws.members.end(), [&ws](int x) { return ws.mark[x] != ws.stamp; });
+                remove(ws, w);
+                add(ws, u);
+                size_t size = ws.members.size();
+
+                for (int x : nG.adjLists[u])
+                {
+                    if (!ws.inClique[x] && (ws.count[x] == (int)ws.members.size()))
+                    {
+                        add(ws, x);
+                    }
+                }
+                improved = improved || (ws.members.size() > size);
+            }
+
+            if (!improved)
+            {
+                break;
+            }
+        }
+
+        if ((int)ws.members.size() + 1 > best)
+        {
+            std::lock_guard<std::mutex> guard(lock);
+
+            if ((int)ws.members.size() + 1 > best)
+            {
+                best = ws.members.size() + 1;
+                clique.assign(1, v);
+
+                for (int u : ws.members)
+                {
+                    clique.push_back(nG.vertices[u]);
+                }
+            }
+        }
+    }
+}
+
+void CliqueHeuristic::add(
+    workspace &ws,
+    int u)
+{
+    ws.inClique[u] = true;
+    ws.members.push_back(u);
+
+    for (int x : ws.nG.adjLists[u])
+    {
+        ws.count[x]++;
+    }
+}
+
+void CliqueHeuristic::remove(
+    workspace &ws,
+    int u)
+{
+    ws.inClique[u] = false;
+    *std::find(ws.members.begin(), ws.members.end(), u) = ws.members.back();
+    ws.members.pop_back();
+
+    for (int x : ws.nG.adjLists[u])
+    {
+        ws.count[x]--;
+    }
+}
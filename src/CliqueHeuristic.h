@@ -0,0 +1,124 @@
+/**@file CliqueHeuristic.h
+ *
+ * @brief Greedy and local search heuristic that finds large cliques before the
+ * exact search starts.
+ *
+ * @details The heuristic visits the vertices of the sorted list (by decreasing
+ * right degree) and, for every vertex v, looks for a large clique in the graph
+ * induced by the right neighbors of v, which together with v is a clique of G:
+ *
+ * - The core numbers of the vertices of G[N+(v)] are computed by peeling them
+ *   (@see NeighborhoodGraph::coreNumbers). Since a clique of G[N+(v)] has at most
+ *   its largest core number + 1 vertices, the vertices that cannot improve the
+ *   best clique are skipped without further work.
+ * - A clique is built greedily, taking the vertices in decreasing order of
+ *   their core number.
+ * - A few rounds of 1-swaps follow: a vertex adjacent to all but one vertex of
+ *   the clique replaces that vertex, after which the clique is extended with
+ *   the vertices adjacent to all of it.
+ *
+ * The vertices are shared by the workers of the pool through an atomic cursor
+ * and the search stops when the time budget is spent. Once the right degree of
+ * a vertex is too small to improve the best clique, so is the one of all the
+ * vertices after it in the sorted list. The best clique raises the lower bound
+ * of @see Clique::findMaxClique, so the exact search skips the clique sizes it
+ * rules out.
+ *
+ * @author Jose L. Walteros
+ *
+ * @version   1.0
+ * @date      June 2018
+ *
+ * Copyright (C) 2018 Jose L. Walteros. All rights reserved.
+ *
+ *---+----+----+----+----+----+----+----+----+----+----+----+----+----+----+----*/
+#ifndef _CLIQUEHEURISTIC_H_
+#define _CLIQUEHEURISTIC_H_
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <vector>
+#include "Graph.h"
+#include "ThreadPool.h"
+#include "NeighborhoodGraph.h"
+
+class CliqueHeuristic
+{
+public:
+    static const int swapRounds = 3; /**< Rounds of 1-swaps per vertex */
+
+    Graph &graph; /**< Graph (with its right neighbors first) */
+    ThreadPool &pool; /**< Workers */
+    std::atomic<int> best; /**< Size of the best clique found */
+    std::vector<int> clique; /**< Best clique found */
+    std::mutex lock; /**< Protects clique */
+    std::atomic<int> numSearched; /**< Vertices whose neighborhood was searched */
+    std::atomic<bool> expired; /**< Whether the time budget was spent */
+
+    /**
+     * CliqueHeuristic constructor.
+     *
+     * @param[in] graph : The graph. Its ordering must have been computed and its
+     * right neighbors moved to the front (@see Graph::rightNeighborsFirst).
+     * @param[in] pool : Workers that run the heuristic.
+     */
+    inline CliqueHeuristic(
+        Graph &graph,
+        ThreadPool &pool) : graph(graph), pool(pool), best(0), numSearched(0), expired(false) {}
+
+    /**
+     * Runs the heuristic.
+     *
+     * @param[in] sortedList : Vertices sorted by decreasing right degree.
+     * @param[in] cliqueLB : Size of a known clique; only larger cliques are kept.
+     * @param[in] budget : Time budget in seconds.
+     *
+     * @returns the size of the best clique found, or cliqueLB if none is larger
+     * (CliqueHeuristic::clique is then empty).
+     */
+    int run(
+        const std::vector<int> &sortedList,
+        int cliqueLB,
+        double budget);
+
+private:
+    /**
+     * Scratch data of a worker.
+     */
+    struct workspace
+    {
+        NeighborhoodGraph nG; /**< G[N+(v)] */
+        std::vector<int> count; /**< Neighbors of the local vertices in the clique */
+        std::vector<char> inClique; /**< Whether the local vertices are in the clique */
+        std::vector<int> members; /**< Local vertices of the clique */
+        std::vector<int> mark; /**< Stamp of the local vertices */
+        int stamp = 0; /**< Current stamp */
+
+        inline workspace(
+            Graph &graph) : nG(graph) {}
+    };
+
+    /**
+     * Searches for a large clique of G[N+(v)], and records {v} plus the clique
+     * if it is better than the best one.
+     */
+    void search(
+        int v,
+        workspace &ws);
+
+    /**
+     * Adds the local vertex u to the clique.
+     */
+    void add(
+        workspace &ws,
+        int u);
+
+    /**
+     * Removes the local vertex u from the clique.
+     */
+    void remove(
+        workspace &ws,
+        int u);
+};
+#endif // _CLIQUEHEURISTIC_H_
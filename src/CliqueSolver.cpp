@@ -0,0 +1,28 @@
+/**@file CliqueSolver.cpp
+ *
+ * @brief Entry point of the library: finds the maximum cliques of the graphs
+ * it is given, one after the other, on the same workers.
+ *
+ * @author Jose L. Walteros
+ *
+ * @version   1.0
+ * @date      June 2018
+ *
+ * Copyright (C) 2018 Jose L. Walteros. All rights reserved.
+ *
+ *---+----+----+----+----+----+----+----+----+----+----+----+----+----+----+----*/
+#include "CliqueSolver.h"
+
+cliqueResult CliqueSolver::solve(
+    Graph &graph)
+{
+    Clique clique(graph, context);
+
+    if (configure)
+    {
+        configure(clique);
+    }
+    clique.log = log;
+    clique.findMaxClique();
+    return clique.result();
+}
@@ -0,0 +1,67 @@
+/**@file CliqueSolver.h
+ *
+ * @brief Entry point of the library: finds the maximum cliques of the graphs
+ * it is given, one after the other, on the same workers.
+ *
+ * @details The solver keeps a SolverContext, so its threads and the scratch
+ * data of the vertex cover search are created once and reused by every graph
+ * (@see SolverContext). The graphs can be read from files or built from
+ * arrays in memory (@see Graph::Graph). For example:
+ *
+ *     CliqueSolver solver(8);
+ *     solver.configure = [](Clique &clique) { clique.heuristicBudget = 0.5; };
+ *     bool read;
+ *     Graph graph(n, tails, heads, numEdges, read, 8);
+ *     cliqueResult result = solver.solve(graph);
+ *
+ * The options of the search are set by CliqueSolver::configure on the Clique
+ * object of every graph, as in the command line.
+ *
+ * @author Jose L. Walteros
+ *
+ * @version   1.0
+ * @date      June 2018
+ *
+ * Copyright (C) 2018 Jose L. Walteros. All rights reserved.
+ *
+ *---+----+----+----+----+----+----+----+----+----+----+----+----+----+----+----*/
+#ifndef _CLIQUESOLVER_H_
+#define _CLIQUESOLVER_H_
+
+#include <functional>
+#include <iostream>
+#include "Clique.h"
+#include "Graph.h"
+#include "SolverContext.h"
+
+class CliqueSolver
+{
+public:
+    SolverContext context; /**< Workers and scratch data shared by the graphs */
+    std::function<void(Clique &)> configure; /**< Sets the options of the
+    * search of every graph (none if empty) */
+    std::ostream *log = nullptr; /**< Stream that receives the summary of every
+    * run (none if null) */
+
+    /**
+     * CliqueSolver constructor.
+     *
+     * @param[in] numThreads : Number of threads.
+     */
+    inline CliqueSolver(
+        int numThreads) : context(numThreads) {}
+
+    /**
+     * Finds the maximum clique of a graph. The degeneracy ordering of the
+     * graph is computed if it was not, and its adjacency lists are reordered
+     * (@see Graph::rightNeighborsFirst).
+     *
+     * @param[in] graph : The graph.
+     *
+     * @returns the size of the maximum clique, one such clique and the times
+     * of the run.
+     */
+    cliqueResult solve(
+        Graph &graph);
+};
+#endif // _CLIQUESOLVER_H_
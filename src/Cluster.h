@@ -0,0 +1,134 @@
+/**@file Cluster.h
+ *
+ * @brief Processes that share the clique search of a graph (@see
+ * Clique::cluster).
+ *
+ * @details Every process reads the whole graph and computes the same
+ * degeneracy ordering and sorted list. Rank 0 picks the clique sizes of every
+ * iteration and the others receive them. During an iteration, the positions of
+ * the sorted list are handed out in blocks by a counter shared by all the
+ * processes, so a process that finishes its blocks early takes the next ones
+ * instead of waiting for the others (the subgraphs of a block, and the tasks
+ * they publish, stay in the process that took it). The processes also share a
+ * flag per clique size that is set when a clique of that size is found, and
+ * the number of processes that ran out of blocks, which proves that there is
+ * no such clique when it reaches the number of processes. The flags and the
+ * counters are polled by every process while its workers run the search, so
+ * the search of a size stops everywhere shortly after a clique is found.
+ *
+ * The procedures that hand out blocks and set or poll the flags may be called
+ * by several threads at the same time. The others are collective: every
+ * process calls them in the same order from a single thread.
+ *
+ * @see MpiCluster for the implementation over MPI (make MPI=1).
+ *
+ * @author Jose L. Walteros
+ *
+ * @version   1.0
+ * @date      June 2018
+ *
+ * Copyright (C) 2018 Jose L. Walteros. All rights reserved.
+ *
+ *---+----+----+----+----+----+----+----+----+----+----+----+----+----+----+----*/
+#ifndef _CLUSTER_H_
+#define _CLUSTER_H_
+
+#include <vector>
+
+class Cluster
+{
+public:
+    static const int blockChunks = 8; /**< Chunks of the scheduler in a block
+    * of the shared counter */
+    static const int pollMicroseconds = 500; /**< Time between two polls of the
+    * flags of an iteration */
+
+    virtual ~Cluster() {}
+
+    /**
+     * Rank of the process, from 0 to Cluster::size() - 1.
+     */
+    virtual int rank() const = 0;
+
+    /**
+     * Number of processes.
+     */
+    virtual int size() const = 0;
+
+    /**
+     * Smallest value given by the processes (collective).
+     */
+    virtual int minimum(
+        int value) = 0;
+
+    /**
+     * Sum of the values given by the processes (collective).
+     */
+    virtual long long sum(
+        long long value) = 0;
+
+    /**
+     * Largest value given by the processes (collective). The items of the
+     * process that gave it (the first one if there are several) are copied to
+     * the others.
+     */
+    virtual int largest(
+        int value,
+        std::vector<int> &items) = 0;
+
+    /**
+     * Copies the values of rank 0 to the other processes (collective).
+     */
+    virtual void broadcast(
+        std::vector<int> &values) = 0;
+
+    /**
+     * Starts an iteration that tests numSizes clique sizes: the counters of
+     * the blocks start at 0 and the flags are cleared (collective).
+     */
+    virtual void beginIteration(
+        int numSizes) = 0;
+
+    /**
+     * Takes the next block [first, last) of the positions of the sorted list
+     * below end that test the clique size of index size.
+     *
+     * @returns false if there are no more positions.
+     */
+    virtual bool nextBlock(
+        int size,
+        int blockSize,
+        int end,
+        int &first,
+        int &last) = 0;
+
+    /**
+     * Sets the flag of the clique size of index size: there is a clique of
+     * that size.
+     */
+    virtual void setFound(
+        int size) = 0;
+
+    /**
+     * Records that the process has no work left for the clique size of index
+     * size, and has not found a clique of that size.
+     */
+    virtual void setDone(
+        int size) = 0;
+
+    /**
+     * Reads the flags of the iteration: found[i] is nonzero if a clique of the
+     * size of index i was found, and done[i] is the number of processes that
+     * ran out of work for it.
+     */
+    virtual void poll(
+        std::vector<int> &found,
+        std::vector<int> &done) = 0;
+
+    /**
+     * Waits until every process has finished the iteration (collective). The
+     * flags read by Cluster::poll afterwards are final.
+     */
+    virtual void endIteration() = 0;
+};
+#endif // _CLUSTER_H_
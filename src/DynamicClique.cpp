@@ -0,0 +1,809 @@
+/**@file DynamicClique.cpp
+ *
+ * @brief Keeps the maximum clique of a graph while batches of edges are
+ * inserted and deleted.
+ *
+ * @author Jose L. Walteros
+ *
+ * @version   1.0
+ * @date      June 2018
+ *
+ * Copyright (C) 2018 Jose L. Walteros. All rights reserved.
+ *
+ *---+----+----+----+----+----+----+----+----+----+----+----+----+----+----+----*/
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <initializer_list>
+#include <sstream>
+#include <string>
+#include "DynamicClique.h"
+
+bool DynamicClique::run(
+    const char *source,
+    std::ostream &out)
+{
+    std::ifstream file;
+    std::istream *input = &std::cin;
+
+    if (strcmp(source, "-") != 0)
+    {
+        file.open(source);
+
+        if (!file)
+        {
+            return false;
+        }
+        input = &file;
+    }
+    initialize();
+    std::vector<update> updates;
+    int numSkipped = 0;
+    bool open = false;
+    std::string line;
+
+    while (true)
+    {
+        bool more = (bool)std::getline(*input, line);
+        size_t begin = more ? line.find_first_not_of(" \t\r") : std::string::npos;
+
+        /**
+         * A blank line or the end of the input closes the batch, if any
+         * update was given since the last one.
+         */
+        if (begin == std::string::npos)
+        {
+            if (open)
+            {
+                applyBatch(updates, numSkipped, out);
+                updates.clear();
+                numSkipped = 0;
+                open = false;
+            }
+
+            if (!more)
+            {
+                break;
+            }
+            continue;
+        }
+
+        if (line[begin] == '#')
+        {
+            continue;
+        }
+        open = true;
+        std::istringstream fields(line.substr(begin));
+        std::string rest;
+        char op;
+        int u;
+        int v;
+
+        if (!(fields >> op >> u >> v) || (fields >> rest) || ((op != '+') && (op != '-')))
+        {
+            numSkipped++;
+            continue;
+        }
+        std::unordered_map<int, int>::iterator first = ids.find(u);
+        std::unordered_map<int, int>::iterator second = ids.find(v);
+
+        if ((first == ids.end()) || (second == ids.end()) || (first->second == second->second))
+        {
+            numSkipped++;
+            continue;
+        }
+        updates.push_back({op == '+', first->second, second->second});
+    }
+    return true;
+}
+
+void DynamicClique::initialize()
+{
+    Graph &graph = clique.graph;
+    ids.clear();
+
+    /**
+     * The vertices that never appear in the file of an edge list share a
+     * name, so a name is taken by a vertex with edges first.
+     */
+    for (int v = 0; v < graph.n; v++)
+    {
+        std::pair<std::unordered_map<int, int>::iterator, bool> entry = ids.emplace(graph.alias[v], v);
+
+        if (!entry.second && (graph.degree[entry.first->second] == 0))
+        {
+            entry.first->second = v;
+        }
+    }
+    capacity = graph.degree;
+    wasted = graph.EdgeTo.size() - 2 * (size_t)graph.m;
+    stamp.assign(graph.n, 0);
+    epoch = 0;
+    support.assign(graph.n, 0);
+    state.assign(graph.n, 0);
+    isAffected.assign(graph.n, 0);
+    affected.clear();
+    computeCores();
+}
+
+void DynamicClique::applyBatch(
+    const std::vector<update> &updates,
+    int numSkipped,
+    std::ostream &out)
+{
+    std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
+    Graph &graph = clique.graph;
+    std::vector<std::pair<int, int> > changed;
+    bool inserted = false;
+    bool deleted = false;
+    int ignored = numSkipped;
+
+    for (const update &edge : updates)
+    {
+        int a = edge.u;
+        int b = edge.v;
+
+        if (graph.position[a] > graph.position[b])
+        {
+            std::swap(a, b);
+        }
+
+        if (adjacent(a, b) == edge.insert)
+        {
+            ignored++;
+            continue;
+        }
+
+        if (edge.insert)
+        {
+            insertEdge(a, b);
+            raiseCores(a, b);
+            inserted = true;
+        }
+        else
+        {
+            deleteEdge(a, b);
+            lowerCores(a, b);
+            deleted = true;
+        }
+        changed.push_back(std::make_pair(a, b));
+    }
+    numBatches++;
+    numApplied += changed.size();
+    numIgnored += ignored;
+    int omega = clique.cliqueLB;
+    bool broken = false;
+    bool reordered = false;
+    clique.numIterations = 0;
+    clique.numTested = 0;
+
+    for (const std::pair<int, int> &edge : changed)
+    {
+        reordered = reordered || (graph.rightDegree[edge.first] > maxCore + reorderSlack);
+    }
+
+    if (reordered)
+    {
+        reorder();
+    }
+    else
+    {
+        if (wasted > graph.EdgeTo.size() / 2)
+        {
+            packRows(false);
+        }
+
+        for (const std::pair<int, int> &edge : changed)
+        {
+            markAffected(edge.first, edge.second);
+        }
+
+        for (int v : affected)
+        {
+            clique.cache.invalidate(v);
+            clique.coreBound[v] = -1;
+            clique.infeasibleK[v] = -1;
+        }
+        broken = deleted && repairClique();
+
+        /**
+         * A larger clique has an inserted edge, so its first vertex is an
+         * affected one whose right degree is at least omega.
+         */
+        if (inserted)
+        {
+            clique.sortedList.clear();
+
+            for (int v : affected)
+            {
+                if (graph.rightDegree[v] + 1 > omega)
+                {
+                    clique.sortedList.push_back(v);
+                }
+            }
+            std::sort(clique.sortedList.begin(), clique.sortedList.end(), [&graph](int a, int b)
+            {
+                return (graph.rightDegree[a] != graph.rightDegree[b]) ? (graph.rightDegree[a] > graph.rightDegree[b]) : (a < b);
+            });
+
+            if (!clique.sortedList.empty())
+            {
+                int bound = std::min(maxCore + 1, graph.rightDegree[clique.sortedList[0]] + 1);
+
+                while (clique.cliqueLB < bound)
+                {
+                    int found = clique.cliqueLB;
+                    clique.cliqueUB = found + 1;
+                    clique.searchSizes(start);
+
+                    if (clique.cliqueLB == found)
+                    {
+                        break;
+                    }
+                }
+            }
+        }
+
+        /**
+         * Without a larger clique, the clique number is between the sizes of
+         * the repaired clique and the old one.
+         */
+        if (broken && (clique.cliqueLB == omega) && ((int)clique.clique.size() < omega))
+        {
+            int maxRight = 0;
+
+            for (int v = 0; v < graph.n; v++)
+            {
+                maxRight = std::max(maxRight, graph.rightDegree[v]);
+            }
+            std::vector<int> buckets(maxRight + 2, 0);
+
+            for (int v = 0; v < graph.n; v++)
+            {
+                buckets[maxRight - graph.rightDegree[v] + 1]++;
+            }
+
+            for (int k = 1; k <= maxRight + 1; k++)
+            {
+                buckets[k] += buckets[k - 1];
+            }
+            clique.sortedList.resize(graph.n);
+
+            for (int v = 0; v < graph.n; v++)
+            {
+                clique.sortedList[buckets[maxRight - graph.rightDegree[v]]++] = v;
+            }
+            clique.cliqueLB = clique.clique.size();
+            clique.cliqueUB = omega;
+            clique.searchSizes(start);
+        }
+        clique.cliqueUB = (int)clique.cliqueLB;
+        clique.collectCounters();
+    }
+    int numAffected = reordered ? graph.n : (int)affected.size();
+
+    for (int v : affected)
+    {
+        isAffected[v] = 0;
+    }
+    affected.clear();
+    double seconds = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+
+    if (clique.log != nullptr)
+    {
+        *clique.log << "Batch " << numBatches << ": " << changed.size() << " updates applied (" << ignored << " ignored), " <<
+        numAffected << " vertices affected, " << clique.numTested << " clique sizes tested, " << clique.numNodes <<
+        " search nodes" << (reordered ? ", ordering computed again" : "") << (broken ? ", clique repaired" : "") <<
+        ", maximum clique size: " << clique.cliqueLB << " (" << seconds << ")\n";
+    }
+    out << graph.name << " " << numBatches << " " << graph.n << " " << graph.m << " " << changed.size() << " " <<
+    ignored << " " << numAffected << " " << maxCore << " " << clique.cliqueLB << " " << seconds << "\n";
+
+    if (printCliques)
+    {
+        clique.printClique(out);
+    }
+    out.flush();
+}
+
+bool DynamicClique::adjacent(
+    int u,
+    int v) const
+{
+    const Graph &graph = clique.graph;
+
+    if (graph.position[u] > graph.position[v])
+    {
+        std::swap(u, v);
+    }
+    const int *row = graph.EdgeTo.data() + graph.EdgesBegin[u];
+    return std::binary_search(row, row + graph.rightDegree[u], v);
+}
+
+void DynamicClique::insertAt(
+    int v,
+    int at,
+    int w)
+{
+    Graph &graph = clique.graph;
+
+    if (graph.degree[v] == capacity[v])
+    {
+        int begin = graph.EdgeTo.size();
+        int room = std::max(2 * capacity[v], 4);
+        graph.EdgeTo.resize(begin + room);
+        std::copy(graph.EdgeTo.begin() + graph.EdgesBegin[v], graph.EdgeTo.begin() + graph.EdgesBegin[v] + graph.degree[v],
+                  graph.EdgeTo.begin() + begin);
+        wasted += room - 1;
+        graph.EdgesBegin[v] = begin;
+        capacity[v] = room;
+    }
+    else
+    {
+        wasted--;
+    }
+    int *row = graph.EdgeTo.data() + graph.EdgesBegin[v];
+    std::copy_backward(row + at, row + graph.degree[v], row + graph.degree[v] + 1);
+    row[at] = w;
+    graph.degree[v]++;
+}
+
+void DynamicClique::eraseAt(
+    int v,
+    int at)
+{
+    Graph &graph = clique.graph;
+    int *row = graph.EdgeTo.data() + graph.EdgesBegin[v];
+    std::copy(row + at + 1, row + graph.degree[v], row + at);
+    graph.degree[v]--;
+    wasted++;
+}
+
+void DynamicClique::insertEdge(
+    int a,
+    int b)
+{
+    Graph &graph = clique.graph;
+
+    /**
+     * b goes to the right neighbors of a, and a to the left neighbors of b.
+     */
+    const int *row = graph.EdgeTo.data() + graph.EdgesBegin[a];
+    insertAt(a, std::lower_bound(row, row + graph.rightDegree[a], b) - row, b);
+    graph.rightDegree[a]++;
+    row = graph.EdgeTo.data() + graph.EdgesBegin[b];
+    insertAt(b, std::lower_bound(row + graph.rightDegree[b], row + graph.degree[b], a) - row, a);
+    graph.m++;
+    graph.Delta = std::max(graph.Delta, std::max(graph.degree[a], graph.degree[b]));
+}
+
+void DynamicClique::deleteEdge(
+    int a,
+    int b)
+{
+    Graph &graph = clique.graph;
+    const int *row = graph.EdgeTo.data() + graph.EdgesBegin[a];
+    eraseAt(a, std::lower_bound(row, row + graph.rightDegree[a], b) - row);
+    graph.rightDegree[a]--;
+    row = graph.EdgeTo.data() + graph.EdgesBegin[b];
+    eraseAt(b, std::lower_bound(row + graph.rightDegree[b], row + graph.degree[b], a) - row);
+    graph.m--;
+    graph.delta = std::min(graph.delta, std::min(graph.degree[a], graph.degree[b]));
+}
+
+void DynamicClique::packRows(
+    bool byId)
+{
+    Graph &graph = clique.graph;
+    std::vector<int> edges(2 * (size_t)graph.m);
+    int next = 0;
+
+    for (int v = 0; v < graph.n; v++)
+    {
+        const int *row = graph.EdgeTo.data() + graph.EdgesBegin[v];
+
+        /**
+         * The right and the left neighbors are sorted by id.
+         */
+        if (byId)
+        {
+            std::merge(row, row + graph.rightDegree[v], row + graph.rightDegree[v], row + graph.degree[v], edges.begin() + next);
+        }
+        else
+        {
+            std::copy(row, row + graph.degree[v], edges.begin() + next);
+        }
+        graph.EdgesBegin[v] = next;
+        next += graph.degree[v];
+    }
+    graph.EdgeTo.swap(edges);
+    capacity = graph.degree;
+    wasted = 0;
+}
+
+void DynamicClique::computeCores()
+{
+    Graph &graph = clique.graph;
+    int n = graph.n;
+    int maxDegree = 0;
+
+    for (int v = 0; v < n; v++)
+    {
+        maxDegree = std::max(maxDegree, graph.degree[v]);
+    }
+    core = graph.degree;
+    std::vector<int> begin(maxDegree + 2, 0);
+    std::vector<int> order(n);
+    std::vector<int> at(n);
+
+    for (int v = 0; v < n; v++)
+    {
+        begin[core[v] + 1]++;
+    }
+
+    for (int k = 1; k <= maxDegree + 1; k++)
+    {
+        begin[k] += begin[k - 1];
+    }
+
+    for (int v = 0; v < n; v++)
+    {
+        at[v] = begin[core[v]]++;
+        order[at[v]] = v;
+    }
+
+    for (int k = maxDegree; k > 0; k--)
+    {
+        begin[k] = begin[k - 1];
+    }
+    begin[0] = 0;
+
+    /**
+     * The vertices are peeled by increasing degree, and every neighbor of
+     * larger degree is moved to the front of the bucket below.
+     */
+    for (int i = 0; i < n; i++)
+    {
+        int v = order[i];
+        const int *row = graph.EdgeTo.data() + graph.EdgesBegin[v];
+
+        for (int j = 0; j < graph.degree[v]; j++)
+        {
+            int u = row[j];
+
+            if (core[u] > core[v])
+            {
+                int first = order[begin[core[u]]];
+
+                if (first != u)
+                {
+                    std::swap(order[at[u]], order[begin[core[u]]]);
+                    std::swap(at[u], at[first]);
+                }
+                begin[core[u]]++;
+                core[u]--;
+            }
+        }
+    }
+    coreCount.assign(n + 1, 0);
+    maxCore = 0;
+
+    for (int v = 0; v < n; v++)
+    {
+        coreCount[core[v]]++;
+        maxCore = std::max(maxCore, core[v]);
+    }
+}
+
+void DynamicClique::setCore(
+    int v,
+    int k)
+{
+    coreCount[core[v]]--;
+    coreCount[k]++;
+    core[v] = k;
+    maxCore = std::max(maxCore, k);
+
+    while ((maxCore > 0) && (coreCount[maxCore] == 0))
+    {
+        maxCore--;
+    }
+}
+
+int DynamicClique::coreDegree(
+    int v,
+    int k) const
+{
+    const Graph &graph = clique.graph;
+    const int *row = graph.EdgeTo.data() + graph.EdgesBegin[v];
+    int count = 0;
+
+    for (int j = 0; j < graph.degree[v]; j++)
+    {
+        count += (core[row[j]] >= k);
+    }
+    return count;
+}
+
+void DynamicClique::raiseCores(
+    int u,
+    int v)
+{
+    Graph &graph = clique.graph;
+    int k = std::min(core[u], core[v]);
+    epoch++;
+    queue.clear();
+    candidates.clear();
+
+    for (int r : {u, v})
+    {
+        if ((core[r] == k) && (stamp[r] != epoch))
+        {
+            stamp[r] = epoch;
+            queue.push_back(r);
+        }
+    }
+
+    /**
+     * Only the vertices with more than k neighbors of core number k or
+     * larger can move to the (k + 1)-core, and the traversal only goes on
+     * through them.
+     */
+    for (size_t i = 0; i < queue.size(); i++)
+    {
+        int w = queue[i];
+
+        if (coreDegree(w, k) <= k)
+        {
+            continue;
+        }
+        state[w] = 1;
+        candidates.push_back(w);
+        const int *row = graph.EdgeTo.data() + graph.EdgesBegin[w];
+
+        for (int j = 0; j < graph.degree[w]; j++)
+        {
+            int x = row[j];
+
+            if ((core[x] == k) && (stamp[x] != epoch))
+            {
+                stamp[x] = epoch;
+                queue.push_back(x);
+            }
+        }
+    }
+
+    /**
+     * The candidates are peeled: the ones with k neighbors or less among
+     * the other candidates and the vertices of larger core number are
+     * evicted.
+     */
+    queue.clear();
+
+    for (int w : candidates)
+    {
+        const int *row = graph.EdgeTo.data() + graph.EdgesBegin[w];
+        support[w] = 0;
+
+        for (int j = 0; j < graph.degree[w]; j++)
+        {
+            support[w] += (core[row[j]] > k) || (state[row[j]] == 1);
+        }
+    }
+
+    for (int w : candidates)
+    {
+        if (support[w] <= k)
+        {
+            state[w] = 2;
+            queue.push_back(w);
+        }
+    }
+
+    for (size_t i = 0; i < queue.size(); i++)
+    {
+        int w = queue[i];
+        const int *row = graph.EdgeTo.data() + graph.EdgesBegin[w];
+
+        for (int j = 0; j < graph.degree[w]; j++)
+        {
+            int x = row[j];
+
+            if ((state[x] == 1) && (--support[x] <= k))
+            {
+                state[x] = 2;
+                queue.push_back(x);
+            }
+        }
+    }
+
+    for (int w : candidates)
+    {
+        if (state[w] == 1)
+        {
+            setCore(w, k + 1);
+        }
+        state[w] = 0;
+    }
+}
+
+void DynamicClique::lowerCores(
+    int u,
+    int v)
+{
+    Graph &graph = clique.graph;
+    int k = std::min(core[u], core[v]);
+    epoch++;
+    queue.clear();
+
+    for (int r : {u, v})
+    {
+        if ((core[r] == k) && (stamp[r] != epoch))
+        {
+            stamp[r] = epoch;
+            support[r] = coreDegree(r, k);
+
+            if (support[r] < k)
+            {
+                state[r] = 1;
+                queue.push_back(r);
+            }
+        }
+    }
+
+    /**
+     * A vertex leaves the k-core once fewer than k of its neighbors are in
+     * it. The neighbors met for the first time count the ones that already
+     * left, and the others lose one.
+     */
+    for (size_t i = 0; i < queue.size(); i++)
+    {
+        int w = queue[i];
+        setCore(w, k - 1);
+        const int *row = graph.EdgeTo.data() + graph.EdgesBegin[w];
+
+        for (int j = 0; j < graph.degree[w]; j++)
+        {
+            int x = row[j];
+
+            if ((core[x] != k) || (state[x] == 1))
+            {
+                continue;
+            }
+
+            if (stamp[x] != epoch)
+            {
+                stamp[x] = epoch;
+                support[x] = coreDegree(x, k);
+            }
+            else
+            {
+                support[x]--;
+            }
+
+            if (support[x] < k)
+            {
+                state[x] = 1;
+                queue.push_back(x);
+            }
+        }
+    }
+
+    for (int w : queue)
+    {
+        state[w] = 0;
+    }
+}
+
+void DynamicClique::markAffected(
+    int a,
+    int b)
+{
+    Graph &graph = clique.graph;
+
+    if (!isAffected[a])
+    {
+        isAffected[a] = 1;
+        affected.push_back(a);
+    }
+
+    /**
+     * The common neighbors before a are left neighbors of both a and b. The
+     * shorter list is searched in the other one.
+     */
+    const int *left = graph.EdgeTo.data() + graph.EdgesBegin[a] + graph.rightDegree[a];
+    int numLeft = graph.degree[a] - graph.rightDegree[a];
+    const int *other = graph.EdgeTo.data() + graph.EdgesBegin[b] + graph.rightDegree[b];
+    int numOther = graph.degree[b] - graph.rightDegree[b];
+
+    if (numLeft > numOther)
+    {
+        std::swap(left, other);
+        std::swap(numLeft, numOther);
+    }
+
+    for (int j = 0; j < numLeft; j++)
+    {
+        int w = left[j];
+
+        if (!isAffected[w] && std::binary_search(other, other + numOther, w))
+        {
+            isAffected[w] = 1;
+            affected.push_back(w);
+        }
+    }
+}
+
+bool DynamicClique::repairClique()
+{
+    Graph &graph = clique.graph;
+    std::vector<int> kept;
+
+    for (int v : clique.clique)
+    {
+        bool adjacentToAll = true;
+
+        for (size_t i = 0; (i < kept.size()) && adjacentToAll; i++)
+        {
+            adjacentToAll = adjacent(v, kept[i]);
+        }
+
+        if (adjacentToAll)
+        {
+            kept.push_back(v);
+        }
+    }
+
+    if (kept.size() == clique.clique.size())
+    {
+        return false;
+    }
+
+    /**
+     * The vertices added are neighbors of the kept vertex of smallest degree.
+     */
+    if (!kept.empty())
+    {
+        int first = *std::min_element(kept.begin(), kept.end(), [&graph](int a, int b) { return graph.degree[a] < graph.degree[b]; });
+        std::vector<int> neighbors(graph.EdgeTo.begin() + graph.EdgesBegin[first],
+                                   graph.EdgeTo.begin() + graph.EdgesBegin[first] + graph.degree[first]);
+
+        for (int w : neighbors)
+        {
+            bool adjacentToAll = true;
+
+            for (size_t i = 0; (i < kept.size()) && adjacentToAll; i++)
+            {
+                adjacentToAll = (w != kept[i]) && adjacent(w, kept[i]);
+            }
+
+            if (adjacentToAll)
+            {
+                kept.push_back(w);
+            }
+        }
+    }
+    clique.clique.swap(kept);
+    return true;
+}
+
+void DynamicClique::reorder()
+{
+    Graph &graph = clique.graph;
+    packRows(true);
+    graph.delta = *std::min_element(graph.degree.begin(), graph.degree.end());
+    graph.Delta = *std::max_element(graph.degree.begin(), graph.degree.end());
+    graph.ordered = false;
+    graph.rightFirst = false;
+    graph.relabeled = false;
+
+    /**
+     * The summary of the search is not written again.
+     */
+    std::ostream *log = clique.log;
+    clique.log = nullptr;
+    clique.findMaxClique();
+    clique.log = log;
+    numReorders++;
+    initialize();
+}
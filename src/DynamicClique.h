@@ -0,0 +1,238 @@
+/**@file DynamicClique.h
+ *
+ * @brief Keeps the maximum clique of a graph while batches of edges are
+ * inserted and deleted.
+ *
+ * @details The search runs once from scratch (@see Clique::findMaxClique), and
+ * then every batch of updates is applied to the graph in place:
+ *
+ * - The rows of the CSR arrays keep their right neighbors first and their left
+ *   neighbors after them, both sorted. A row that runs out of room moves to
+ *   the end of Graph::EdgeTo with twice its capacity, and the rows are packed
+ *   again once half of the array is unused.
+ * - The core numbers are updated edge by edge with the traversal algorithm:
+ *   an insertion can only raise by one the core number K of the vertices of
+ *   core number K connected to its endpoints through vertices with more than
+ *   K neighbors of core number K or larger, and a deletion can only lower the
+ *   ones of the vertices connected to its endpoints through vertices whose
+ *   core number drops.
+ * - The degeneracy ordering is kept fixed, so an update of the edge uv, with u
+ *   before v, only changes the right neighborhoods of u and of the common
+ *   neighbors of u and v that come before u. Those vertices are the affected
+ *   ones: their subgraphs are removed from the cache (@see
+ *   SubgraphCache::invalidate), and their bounds and infeasible sizes are
+ *   forgotten. The other vertices keep them.
+ * - Every clique larger than the clique number has an inserted edge, so its
+ *   first vertex is affected. The sizes above the clique number are tested on
+ *   the affected vertices alone (@see Clique::searchSizes), one at a time.
+ * - If a deleted edge breaks the clique kept, it is repaired greedily, and the
+ *   sizes between the repaired clique and the old clique number are tested on
+ *   all the vertices, which reuse what the unaffected ones know.
+ *
+ * The right degrees grow with the insertions, so once the right degree of a
+ * vertex exceeds the degeneracy by more than DynamicClique::reorderSlack, the
+ * ordering is computed again and the search runs from scratch.
+ *
+ * The updates are read as lines "+ u v" (insertion) and "- u v" (deletion),
+ * with the names of the vertices in the file of the graph, and a blank line
+ * (or the end of the input) closes a batch. Lines that start with # are
+ * skipped. The updates that name an unknown vertex, a loop, an edge already in
+ * the graph (insertion) or one that is not (deletion) are ignored, and so are
+ * the malformed lines. The vertices of the graph never change.
+ *
+ * @author Jose L. Walteros
+ *
+ * @version   1.0
+ * @date      June 2018
+ *
+ * Copyright (C) 2018 Jose L. Walteros. All rights reserved.
+ *
+ *---+----+----+----+----+----+----+----+----+----+----+----+----+----+----+----*/
+#ifndef _DYNAMICCLIQUE_H_
+#define _DYNAMICCLIQUE_H_
+
+#include <chrono>
+#include <iostream>
+#include <unordered_map>
+#include <vector>
+#include "Clique.h"
+
+class DynamicClique
+{
+public:
+    Clique &clique; /**< Search that keeps the maximum clique */
+    int reorderSlack = 8; /**< Largest excess of a right degree over the
+    * degeneracy before the ordering is computed again */
+    bool printCliques = false; /**< Whether the vertices of the maximum clique
+    * follow the result line of every batch */
+    int numBatches = 0; /**< Batches applied */
+    long long numApplied = 0; /**< Updates applied */
+    long long numIgnored = 0; /**< Updates ignored */
+    int numReorders = 0; /**< Times the ordering was computed again */
+
+    /**
+     * DynamicClique constructor.
+     *
+     * @param[in] clique : Search whose Clique::findMaxClique has run (in a
+     * single process).
+     */
+    inline DynamicClique(
+        Clique &clique) : clique(clique) {}
+
+    /**
+     * Applies the batches of updates of a file or, if source is "-", of the
+     * standard input, and writes the result line of every batch as soon as it
+     * is applied:
+     *
+     * <filename batch n m applied ignored affected d omega time>
+     *
+     * where d is the degeneracy of the graph after the batch.
+     *
+     * @returns false if the source could not be read.
+     */
+    bool run(
+        const char *source,
+        std::ostream &out);
+
+private:
+    /**
+     * Update of an edge, given by the ids of its endpoints.
+     */
+    struct update
+    {
+        bool insert; /**< Whether the edge is inserted or deleted */
+        int u; /**< First endpoint */
+        int v; /**< Second endpoint */
+    };
+
+    std::unordered_map<int, int> ids; /**< Id of every vertex name */
+    std::vector<int> capacity; /**< Room of the row of every vertex */
+    size_t wasted = 0; /**< Entries of Graph::EdgeTo out of the rows */
+    std::vector<int> core; /**< Core number of every vertex */
+    std::vector<int> coreCount; /**< Vertices of every core number */
+    int maxCore = 0; /**< Degeneracy */
+    std::vector<int> stamp; /**< Traversal that last visited every vertex */
+    int epoch = 0; /**< Current traversal */
+    std::vector<int> support; /**< Neighbors that keep a vertex in its core */
+    std::vector<char> state; /**< Whether a vertex of the traversal is a
+    * candidate (1) or was evicted (2) */
+    std::vector<int> queue; /**< Vertices of the traversal */
+    std::vector<int> candidates; /**< Candidates of the traversal */
+    std::vector<char> isAffected; /**< Whether a vertex is affected by the batch */
+    std::vector<int> affected; /**< Vertices affected by the batch */
+
+    /**
+     * Takes the ids, the row capacities and the core numbers of the graph
+     * searched by the last Clique::findMaxClique.
+     */
+    void initialize();
+
+    /**
+     * Applies a batch, updates the maximum clique and writes its result line.
+     */
+    void applyBatch(
+        const std::vector<update> &updates,
+        int numMalformed,
+        std::ostream &out);
+
+    /**
+     * Whether u and v are adjacent.
+     */
+    bool adjacent(
+        int u,
+        int v) const;
+
+    /**
+     * Inserts w at the position at of the row of v, which is moved to the end
+     * of Graph::EdgeTo if it is full.
+     */
+    void insertAt(
+        int v,
+        int at,
+        int w);
+
+    /**
+     * Removes the entry at the position at of the row of v.
+     */
+    void eraseAt(
+        int v,
+        int at);
+
+    /**
+     * Inserts the edge ab, where a comes before b in the ordering.
+     */
+    void insertEdge(
+        int a,
+        int b);
+
+    /**
+     * Deletes the edge ab, where a comes before b in the ordering.
+     */
+    void deleteEdge(
+        int a,
+        int b);
+
+    /**
+     * Packs the rows at the front of Graph::EdgeTo, keeping their order or
+     * sorting them by id if byId is set.
+     */
+    void packRows(
+        bool byId);
+
+    /**
+     * Computes the core numbers by bucket peeling.
+     */
+    void computeCores();
+
+    /**
+     * Sets the core number of v.
+     */
+    void setCore(
+        int v,
+        int k);
+
+    /**
+     * Number of neighbors of v whose core number is at least k.
+     */
+    int coreDegree(
+        int v,
+        int k) const;
+
+    /**
+     * Updates the core numbers after the insertion of the edge uv.
+     */
+    void raiseCores(
+        int u,
+        int v);
+
+    /**
+     * Updates the core numbers after the deletion of the edge uv.
+     */
+    void lowerCores(
+        int u,
+        int v);
+
+    /**
+     * Marks as affected a and the common neighbors of a and b before a, where
+     * a comes before b in the ordering.
+     */
+    void markAffected(
+        int a,
+        int b);
+
+    /**
+     * Makes the clique kept a clique again after deletions, by dropping the
+     * vertices that are not adjacent to the ones before them and then adding
+     * the common neighbors of the rest greedily.
+     *
+     * @returns whether the clique was broken.
+     */
+    bool repairClique();
+
+    /**
+     * Packs the rows sorted by id and runs the search from scratch, which
+     * computes the ordering again.
+     */
+    void reorder();
+};
+#endif // _DYNAMICCLIQUE_H_
@@ -0,0 +1,1745 @@
+/**
+ *
+ * @file  Graph.cpp
+ *
+ * @brief  Graph represesentation class consisting of the adjacency lists of its
+ * vertices.
+ *
+ * @details This class reads either a standard edge type file or an adjacency
+ * lists file (@see Graph::Graph for details). The Graph class also implements a
+ * procedure that generates a degeneracy ordering of the given graph
+ * (@see Graph::degeneracyOrdering) and a procedure that outputs the complement
+ * of the subgraph induced by a givenv ertex v and its neighbors to the right in
+ * the degeneracy ordering.
+ *
+ * @author Jose L. Walteros
+ *
+ * @version   1.0
+ * @date      January 2018
+ *
+ * Copyright (C) 2018 Jose L. Walteros. All rights reserved.
+ *
+ *---+----+----+----+----+----+----+----+----+----+----+----+----+----+----+----*/
+#include "Graph.h"
+#include <cstring>
+#include <iostream>
+#include <vector>
+#include <string>
+#include <set>
+#include <map>
+#include <fstream>
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <climits>
+#include <unordered_map>
+#include "Bitset.h"
+#include "MappedFile.h"
+#include "Snapshot.h"
+#include "SortedSet.h"
+#include "StreamReader.h"
+#include "ThreadPool.h"
+
+/**
+ * Runs function(t) for t = 0, ..., numThreads - 1, each call on its own thread
+ * (t = 0 runs on the calling thread), and waits until all of them return.
+ */
+template <typename Function>
+static void parallelFor(
+    int numThreads,
+    Function function)
+{
+    std::vector<std::thread> threads;
+
+    for (int t = 1; t < numThreads; t++)
+    {
+        threads.push_back(std::thread(function, t));
+    }
+    function(0);
+
+    for (std::thread &th : threads)
+    {
+        th.join();
+    }
+}
+
+static inline bool isBlank(
+    char c)
+{
+    return (c == ' ') || (c == '\n') || (c == '\t') || (c == '\r') || (c == '\v') || (c == '\f');
+}
+
+/**
+ * Parses the integer token that starts at the first non-blank character after
+ * p. If inLine is true, the search stops at the end of the line. Returns false
+ * if there are no more tokens.
+ */
+static inline bool nextInt(
+    const char *&p,
+    const char *end,
+    int &value,
+    bool inLine)
+{
+    while ((p < end) && isBlank(*p))
+    {
+        if (inLine && (*p == '\n'))
+        {
+            return false;
+        }
+        p++;
+    }
+
+    if (p == end)
+    {
+        return false;
+    }
+
+    bool negative = (*p == '-');
+
+    if (negative)
+    {
+        p++;
+    }
+
+    int x = 0;
+
+    while ((p < end) && (*p >= '0') && (*p <= '9'))
+    {
+        x = 10 * x + (*p - '0');
+        p++;
+    }
+
+    while ((p < end) && !isBlank(*p))
+    {
+        p++;
+    }
+    value = negative ? -x : x;
+    return true;
+}
+
+/**
+ * Splits [begin, end) into numChunks consecutive chunks of roughly the same
+ * size. The chunks start either at the beginning of a line (atLines) or at a
+ * blank character, so no token is split between two chunks.
+ */
+static std::vector<const char *> splitChunks(
+    const char *begin,
+    const char *end,
+    int numChunks,
+    bool atLines)
+{
+    std::vector<const char *> bounds(numChunks + 1);
+    size_t length = end - begin;
+    bounds[0] = begin;
+    bounds[numChunks] = end;
+
+    for (int t = 1; t < numChunks; t++)
+    {
+        const char *c = std::max(begin + length / numChunks * t, bounds[t - 1]);
+
+        if (atLines)
+        {
+            while ((c < end) && (c > begin) && (c[-1] != '\n'))
+            {
+                c++;
+            }
+        }
+        else
+        {
+            while ((c < end) && !isBlank(*c))
+            {
+                c++;
+            }
+        }
+        bounds[t] = c;
+    }
+    return bounds;
+}
+
+/**
+ * First element of the t-th of numThreads consecutive slices of [0, size).
+ */
+static inline long long sliceBegin(
+    long long size,
+    int t,
+    int numThreads)
+{
+    return size / numThreads * t + std::min<long long>(t, size % numThreads);
+}
+
+/**
+ * Sorts and removes the duplicates of the rows [first, last) of a CSR array
+ * whose rows begin at rowBegin. The resulting length of each row is stored in
+ * rowLength. The rows are handed out in blocks through cursor.
+ */
+static void sortAndUniqueRows(
+    std::vector<int> &adjacency,
+    const std::vector<int> &rowBegin,
+    std::vector<int> &rowLength,
+    std::atomic<int> &cursor,
+    int numRows)
+{
+    const int blockSize = 1024;
+    int first;
+
+    while ((first = cursor.fetch_add(blockSize)) < numRows)
+    {
+        int last = std::min(first + blockSize, numRows);
+
+        for (int i = first; i < last; i++)
+        {
+            std::vector<int>::iterator rowStart = adjacency.begin() + rowBegin[i];
+            std::vector<int>::iterator rowEnd = adjacency.begin() + rowBegin[i + 1];
+            std::sort(rowStart, rowEnd);
+            rowLength[i] = std::unique(rowStart, rowEnd) - rowStart;
+        }
+    }
+}
+
+/**
+ * Counting pass of the construction of the CSR of a graph with n vertices from
+ * the edges e = 0, ..., numEdges - 1, given by edge(e, u, v): the rows of raw
+ * are sized by the number of occurrences of each vertex (loops are dropped)
+ * and filled through atomic cursors. The rows begin at rawBegin and may have
+ * duplicates (@see Graph::compactRows).
+ */
+template <typename Edge>
+static void fillRows(
+    int n,
+    Edge edge,
+    long long numEdges,
+    int numThreads,
+    std::vector<int> &raw,
+    std::vector<int> &rawBegin)
+{
+    std::vector<std::atomic<int> > cursor(n);
+    rawBegin.assign(n + 1, 0);
+
+    parallelFor(numThreads, [&](int t)
+    {
+        for (long long i = sliceBegin(n, t, numThreads); i < sliceBegin(n, t + 1, numThreads); i++)
+        {
+            cursor[i].store(0, std::memory_order_relaxed);
+        }
+    });
+
+    parallelFor(numThreads, [&](int t)
+    {
+        int u;
+        int v;
+
+        for (long long e = sliceBegin(numEdges, t, numThreads); e < sliceBegin(numEdges, t + 1, numThreads); e++)
+        {
+            edge(e, u, v);
+
+            if (u != v)
+            {
+                cursor[u].fetch_add(1, std::memory_order_relaxed);
+                cursor[v].fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+    });
+
+    for (int i = 0; i < n; i++)
+    {
+        rawBegin[i + 1] = rawBegin[i] + cursor[i].load(std::memory_order_relaxed);
+        cursor[i].store(rawBegin[i], std::memory_order_relaxed);
+    }
+    raw.resize(rawBegin[n]);
+
+    parallelFor(numThreads, [&](int t)
+    {
+        int u;
+        int v;
+
+        for (long long e = sliceBegin(numEdges, t, numThreads); e < sliceBegin(numEdges, t + 1, numThreads); e++)
+        {
+            edge(e, u, v);
+
+            if (u != v)
+            {
+                raw[cursor[u].fetch_add(1, std::memory_order_relaxed)] = v;
+                raw[cursor[v].fetch_add(1, std::memory_order_relaxed)] = u;
+            }
+        }
+    });
+}
+
+Graph::Graph(
+    const char *type,
+    const char *filename,
+    bool &read,
+    int numThreads,
+    long long streamBudget)
+{
+    name = filename;
+    this->numThreads = std::max(numThreads, 1);
+
+    if (strcmp(type, "-se") == 0)
+    {
+        std::chrono::high_resolution_clock::time_point begin_time = std::chrono::high_resolution_clock::now();
+        read = StreamReader::read(*this, filename, streamBudget, this->numThreads);
+        std::chrono::high_resolution_clock::time_point end_time = std::chrono::high_resolution_clock::now();
+        readTime = std::chrono::duration_cast<std::chrono::duration<double> >(end_time - begin_time);
+        return;
+    }
+
+    if ((strcmp(type, "-pe") == 0) || (strcmp(type, "-pa") == 0))
+    {
+        readMappedFile(type, filename, numThreads, read);
+        return;
+    }
+
+    if (strcmp(type, "-b") == 0)
+    {
+        std::chrono::high_resolution_clock::time_point begin_time = std::chrono::high_resolution_clock::now();
+        read = Snapshot::read(*this, filename);
+        std::chrono::high_resolution_clock::time_point end_time = std::chrono::high_resolution_clock::now();
+        readTime = std::chrono::duration_cast<std::chrono::duration<double> >(end_time - begin_time);
+        return;
+    }
+    std::ifstream file(filename);
+
+    if (!file)
+    {
+        std::cerr << "ERROR: could not open file '" << filename <<
+        " for reading" << std::endl;
+        read = false;
+    }
+    file >> n >> m;
+
+    if (n * m == 0)
+    {
+        std::cerr << "ERROR: when reading the graph from file '" << filename;
+        read = false;
+    }
+    else
+    {
+        /*
+         * The input files have several inconsistencies including duplicated
+         * edges.
+         *
+         * The adjacency lists are first filtered by a set that removes duplicates.
+         * Additionally, this filtering process sorts the adjacency lists, which
+         * is quite useful. The filtering process increases the time required to
+         * generate the graph, but removes duplicates. Cannot be removed unless the
+         * input files are fixed first.
+         */
+        int i;
+        int j;
+        int counter;
+        int real_m = 0;
+        EdgesBegin = std::vector<int>(n, 0);
+        degree = std::vector<int>(n, 0);
+        alias = std::vector<int>(n, 0);
+        std::vector<std::set<int> > adjLists(n, std::set<int>());
+        real_m = 0;
+        std::chrono::high_resolution_clock::time_point begin_time = std::chrono::high_resolution_clock::now();
+
+        /*
+         * Procedure for reading edge list input files. The adjacency lists are
+         * first created as sets to ensure there are no duplicated edges and loops.
+         */
+        if (strcmp(type, "-e") == 0)
+        {
+            std::map<int, int> nameMap;
+            counter = 0;
+            int u;
+            int v;
+            std::map<int, int>::iterator it;
+
+            for (int e = 0; e < m; e++)
+            {
+                file >> i >> j;
+
+                it = nameMap.find(i);
+
+                if (it != nameMap.end())
+                {
+                    u = nameMap[i];
+                }
+                else
+                {
+                    nameMap[i] = counter;
+                    alias[counter] = i;
+                    u = counter;
+                    counter++;
+                }
+                it = nameMap.find(j);
+
+                if (it != nameMap.end())
+                {
+                    v = nameMap[j];
+                }
+                else
+                {
+                    nameMap[j] = counter;
+                    alias[counter] = j;
+                    v = counter;
+                    counter++;
+                }
+
+                if ((u != v) && adjLists[u].insert(v).second)
+                {
+                    degree[u]++;
+                    real_m++;
+                }
+
+                if ((u != v) && adjLists[v].insert(u).second)
+                {
+                    degree[v]++;
+                }
+            }
+        }
+        else
+        {
+            /*
+             * Procedure for reading edge list input files. The adjacency lists
+             * are first created as sets to ensure there are no duplicated edges
+             * and loops.
+             */
+            if (strcmp(type, "-a") == 0)
+            {
+                /**
+                 * These files are assumed to list the vertices starting with 1
+                 */
+
+                std::string str;
+                i = 0;
+
+                std::getline(file, str);
+
+                while (std::getline(file, str))
+                {
+                    std::istringstream ss(str);
+                    alias[i] = i + 1;
+
+                    while (ss >> j)
+                    {
+                        if ((adjLists[i].insert(j - 1)).second)
+                        {
+                            degree[i]++;
+                        }
+                    }
+                    real_m += degree[i];
+                    i++;
+                }
+                real_m = real_m / 2;
+            }
+        }
+        m = real_m;
+
+        EdgeTo = std::vector<int>(2 * m);
+        delta = n;
+        Delta = 0;
+        counter = 0;
+
+        /*
+         * The following procedure extracts the adjacency lists from the filter
+         * created by the sets. We don't keep the sets because std::vectors
+         * tend to perform better. The extra I/O overhead of the filter is a
+         * result of the inconsistencies in most of the graph files used for
+         * testing.
+         */
+        for (int i = 0; i < n; i++)
+        {
+            if (degree[i] < delta)
+            {
+                delta = degree[i];
+            }
+
+            if (degree[i] > Delta)
+            {
+                Delta = degree[i];
+            }
+            EdgesBegin[i] = counter;
+
+            for (std::set<int>::iterator it = adjLists[i].begin(); it != adjLists[i].end(); ++it)
+            {
+                EdgeTo[counter++] = *it;
+            }
+        }
+
+        std::chrono::high_resolution_clock::time_point end_time = std::chrono::high_resolution_clock::now();
+        readTime = std::chrono::duration_cast<std::chrono::duration<double> >(end_time - begin_time);
+        rightDegree = std::vector<int>(n, 0);
+        position = std::vector<int>(n, 0);
+        ordering = std::vector<int>(n, 0);
+    }
+}
+
+Graph::Graph(
+    int n,
+    const int *tails,
+    const int *heads,
+    long long numEdges,
+    bool &read,
+    int numThreads)
+{
+    std::chrono::high_resolution_clock::time_point begin_time = std::chrono::high_resolution_clock::now();
+    name = "memory";
+    this->n = n;
+    this->numThreads = std::max(numThreads, 1);
+    read = (n > 0);
+
+    for (long long e = 0; read && (e < numEdges); e++)
+    {
+        read = (tails[e] >= 0) && (tails[e] < n) && (heads[e] >= 0) && (heads[e] < n);
+    }
+
+    if (!read)
+    {
+        std::cerr << "ERROR: the edges have endpoints outside of [0, " << n << ")" << std::endl;
+        return;
+    }
+    alias = std::vector<int>(n);
+
+    for (int i = 0; i < n; i++)
+    {
+        alias[i] = i;
+    }
+
+    std::vector<int> raw;
+    std::vector<int> rawBegin;
+    fillRows(n, [tails, heads](long long e, int &u, int &v)
+    {
+        u = tails[e];
+        v = heads[e];
+    }, numEdges, this->numThreads, raw, rawBegin);
+    compactRows(raw, rawBegin, this->numThreads);
+    finishCSR();
+    std::chrono::high_resolution_clock::time_point end_time = std::chrono::high_resolution_clock::now();
+    readTime = std::chrono::duration_cast<std::chrono::duration<double> >(end_time - begin_time);
+}
+
+Graph::Graph(
+    std::vector<int> &&offsets,
+    std::vector<int> &&adjacency,
+    bool &read,
+    int numThreads)
+{
+    std::chrono::high_resolution_clock::time_point begin_time = std::chrono::high_resolution_clock::now();
+    name = "memory";
+    n = (int)offsets.size() - 1;
+    this->numThreads = std::max(numThreads, 1);
+    read = (n > 0) && (offsets[0] == 0) && (offsets[n] == (long long)adjacency.size());
+
+    /**
+     * The rows must be sorted, without loops or duplicates, and every edge
+     * must be in the rows of both endpoints.
+     */
+    for (int i = 0; read && (i < n); i++)
+    {
+        read = (offsets[i] <= offsets[i + 1]);
+
+        for (int j = offsets[i]; read && (j < offsets[i + 1]); j++)
+        {
+            int u = adjacency[j];
+            read = (u >= 0) && (u < n) && (u != i) && ((j == offsets[i]) || (adjacency[j - 1] < u));
+        }
+    }
+
+    for (int i = 0; read && (i < n); i++)
+    {
+        for (int j = offsets[i]; read && (j < offsets[i + 1]); j++)
+        {
+            int u = adjacency[j];
+            read = std::binary_search(adjacency.begin() + offsets[u], adjacency.begin() + offsets[u + 1], i);
+        }
+    }
+
+    if (!read)
+    {
+        std::cerr << "ERROR: the arrays are not the CSR of an undirected graph" << std::endl;
+        return;
+    }
+    EdgeTo.swap(adjacency);
+    EdgesBegin.swap(offsets);
+    degree = std::vector<int>(n);
+    alias = std::vector<int>(n);
+
+    for (int i = 0; i < n; i++)
+    {
+        degree[i] = EdgesBegin[i + 1] - EdgesBegin[i];
+        alias[i] = i;
+    }
+    EdgesBegin.pop_back();
+    m = EdgeTo.size() / 2;
+    finishCSR();
+    std::chrono::high_resolution_clock::time_point end_time = std::chrono::high_resolution_clock::now();
+    readTime = std::chrono::duration_cast<std::chrono::duration<double> >(end_time - begin_time);
+}
+
+void Graph::readMappedFile(
+    const char *type,
+    const char *filename,
+    int numThreads,
+    bool &read)
+{
+    std::chrono::high_resolution_clock::time_point begin_time = std::chrono::high_resolution_clock::now();
+    MappedFile file(filename);
+
+    if (!file.open)
+    {
+        std::cerr << "ERROR: could not open file '" << filename <<
+        " for reading" << std::endl;
+        read = false;
+        return;
+    }
+
+    const char *p = file.data;
+    const char *end = file.data + file.size;
+    n = 0;
+    m = 0;
+    nextInt(p, end, n, false);
+    nextInt(p, end, m, false);
+
+    if (n * m == 0)
+    {
+        std::cerr << "ERROR: when reading the graph from file '" << filename;
+        read = false;
+        return;
+    }
+
+    numThreads = std::max(numThreads, 1);
+    degree = std::vector<int>(n, 0);
+    alias = std::vector<int>(n, 0);
+
+    if (strcmp(type, "-pe") == 0)
+    {
+        readMappedEdgeList(p, end, numThreads, read);
+
+        if (!read)
+        {
+            std::cerr << "ERROR: file '" << filename << "' has more than " <<
+            n << " vertices" << std::endl;
+            return;
+        }
+    }
+    else
+    {
+        /**
+         * The rest of the header line is skipped, as the stream reader does.
+         */
+        while ((p < end) && (*p != '\n'))
+        {
+            p++;
+        }
+
+        if (p < end)
+        {
+            p++;
+        }
+        readMappedAdjacencyLists(p, end, numThreads);
+    }
+
+    finishCSR();
+    std::chrono::high_resolution_clock::time_point end_time = std::chrono::high_resolution_clock::now();
+    readTime = std::chrono::duration_cast<std::chrono::duration<double> >(end_time - begin_time);
+}
+
+void Graph::readMappedEdgeList(
+    const char *begin,
+    const char *end,
+    int numThreads,
+    bool &read)
+{
+    /**
+     * First pass: every thread counts the tokens of its chunk, so that the
+     * second pass can write the endpoints of the edges directly in file order.
+     * Only the first m edges are read, as the stream reader does.
+     */
+    std::vector<const char *> bounds = splitChunks(begin, end, numThreads, false);
+    std::vector<long long> tokenBegin(numThreads + 1, 0);
+
+    parallelFor(numThreads, [&](int t)
+    {
+        long long count = 0;
+
+        for (const char *c = bounds[t]; c < bounds[t + 1]; c++)
+        {
+            if (!isBlank(*c) && ((c == bounds[t]) || isBlank(c[-1])))
+            {
+                count++;
+            }
+        }
+        tokenBegin[t + 1] = count;
+    });
+
+    for (int t = 0; t < numThreads; t++)
+    {
+        tokenBegin[t + 1] += tokenBegin[t];
+    }
+
+    long long numTokens = std::min(tokenBegin[numThreads], 2LL * m) / 2 * 2;
+    std::vector<int> endpoints(numTokens);
+    std::vector<int> minNames(numThreads, INT_MAX);
+    std::vector<int> maxNames(numThreads, INT_MIN);
+
+    parallelFor(numThreads, [&](int t)
+    {
+        const char *c = bounds[t];
+        long long e = tokenBegin[t];
+        int value;
+
+        while ((e < numTokens) && nextInt(c, bounds[t + 1], value, false))
+        {
+            endpoints[e++] = value;
+            minNames[t] = std::min(minNames[t], value);
+            maxNames[t] = std::max(maxNames[t], value);
+        }
+    });
+
+    /**
+     * The vertices are renamed in order of first appearance. If the names are
+     * small non-negative integers, the first appearance of each name is found
+     * in parallel over a dense table with an atomic minimum; the names that
+     * appear for the first time at position e get consecutive ids in the order
+     * of e. The renamed ids are stored temporarily as negative numbers so that
+     * they cannot be confused with positions. Otherwise, a hash map is used.
+     */
+    int minName = *std::min_element(minNames.begin(), minNames.end());
+    int maxName = *std::max_element(maxNames.begin(), maxNames.end());
+    std::vector<long long> slice(numThreads + 1);
+
+    for (int t = 0; t <= numThreads; t++)
+    {
+        slice[t] = sliceBegin(numTokens, t, numThreads);
+    }
+
+    int numNames = 0;
+
+    if ((numTokens > 0) && (minName >= 0) && (maxName < 4 * numTokens + n))
+    {
+        std::vector<std::atomic<int> > first(maxName + 1);
+        std::vector<int> numFirst(numThreads + 1, 0);
+
+        parallelFor(numThreads, [&](int t)
+        {
+            for (long long i = sliceBegin(maxName + 1LL, t, numThreads); i < sliceBegin(maxName + 1LL, t + 1, numThreads); i++)
+            {
+                first[i].store(INT_MAX, std::memory_order_relaxed);
+            }
+        });
+
+        parallelFor(numThreads, [&](int t)
+        {
+            for (long long e = slice[t]; e < slice[t + 1]; e++)
+            {
+                std::atomic<int> &f = first[endpoints[e]];
+                int current = f.load(std::memory_order_relaxed);
+
+                while ((e < current) && !f.compare_exchange_weak(current, static_cast<int>(e), std::memory_order_relaxed))
+                {
+                }
+            }
+        });
+
+        parallelFor(numThreads, [&](int t)
+        {
+            for (long long e = slice[t]; e < slice[t + 1]; e++)
+            {
+                if (first[endpoints[e]].load(std::memory_order_relaxed) == e)
+                {
+                    numFirst[t + 1]++;
+                }
+            }
+        });
+
+        for (int t = 0; t < numThreads; t++)
+        {
+            numFirst[t + 1] += numFirst[t];
+        }
+        numNames = numFirst[numThreads];
+
+        if (numNames > n)
+        {
+            read = false;
+            return;
+        }
+
+        parallelFor(numThreads, [&](int t)
+        {
+            int counter = numFirst[t];
+
+            for (long long e = slice[t]; e < slice[t + 1]; e++)
+            {
+                if (first[endpoints[e]].load(std::memory_order_relaxed) == e)
+                {
+                    alias[counter] = endpoints[e];
+                    first[endpoints[e]].store(-1 - counter, std::memory_order_relaxed);
+                    counter++;
+                }
+            }
+        });
+
+        parallelFor(numThreads, [&](int t)
+        {
+            for (long long e = slice[t]; e < slice[t + 1]; e++)
+            {
+                endpoints[e] = -1 - first[endpoints[e]].load(std::memory_order_relaxed);
+            }
+        });
+    }
+    else
+    {
+        std::unordered_map<int, int> nameMap;
+        nameMap.reserve(n);
+
+        for (long long e = 0; e < numTokens; e++)
+        {
+            std::pair<std::unordered_map<int, int>::iterator, bool> it = nameMap.insert(std::make_pair(endpoints[e], numNames));
+
+            if (it.second)
+            {
+                if (numNames == n)
+                {
+                    read = false;
+                    return;
+                }
+                alias[numNames++] = endpoints[e];
+            }
+            endpoints[e] = it.first->second;
+        }
+    }
+
+    /**
+     * The edges are the consecutive pairs of endpoints.
+     */
+    std::vector<int> raw;
+    std::vector<int> rawBegin;
+    fillRows(n, [&endpoints](long long e, int &u, int &v)
+    {
+        u = endpoints[2 * e];
+        v = endpoints[2 * e + 1];
+    }, numTokens / 2, numThreads, raw, rawBegin);
+    std::vector<int>().swap(endpoints);
+    compactRows(raw, rawBegin, numThreads);
+}
+
+void Graph::compactRows(
+    std::vector<int> &raw,
+    const std::vector<int> &rawBegin,
+    int numThreads)
+{
+    std::atomic<int> rowCursor(0);
+    degree = std::vector<int>(n, 0);
+
+    parallelFor(numThreads, [&](int)
+    {
+        sortAndUniqueRows(raw, rawBegin, degree, rowCursor, n);
+    });
+
+    EdgesBegin = std::vector<int>(n, 0);
+    int counter = 0;
+
+    for (int i = 0; i < n; i++)
+    {
+        EdgesBegin[i] = counter;
+        counter += degree[i];
+    }
+    m = counter / 2;
+    EdgeTo = std::vector<int>(counter);
+
+    parallelFor(numThreads, [&](int t)
+    {
+        for (long long i = sliceBegin(n, t, numThreads); i < sliceBegin(n, t + 1, numThreads); i++)
+        {
+            std::copy(raw.begin() + rawBegin[i], raw.begin() + rawBegin[i] + degree[i], EdgeTo.begin() + EdgesBegin[i]);
+        }
+    });
+}
+
+void Graph::finishCSR()
+{
+    delta = n;
+    Delta = 0;
+
+    for (int i = 0; i < n; i++)
+    {
+        delta = std::min(delta, degree[i]);
+        Delta = std::max(Delta, degree[i]);
+    }
+    rightDegree = std::vector<int>(n, 0);
+    position = std::vector<int>(n, 0);
+    ordering = std::vector<int>(n, 0);
+}
+
+void Graph::readMappedAdjacencyLists(
+    const char *begin,
+    const char *end,
+    int numThreads)
+{
+    /**
+     * Line i of the file (after the header) is the adjacency list of vertex i,
+     * labeled from 1. Every thread counts the lines of its chunk first to know
+     * the vertex its chunk starts with.
+     */
+    std::vector<const char *> bounds = splitChunks(begin, end, numThreads, true);
+    std::vector<int> rowBegin(numThreads + 1, 0);
+
+    parallelFor(numThreads, [&](int t)
+    {
+        int count = 0;
+
+        for (const char *c = bounds[t]; c < bounds[t + 1]; c++)
+        {
+            if ((c == begin) || (c[-1] == '\n'))
+            {
+                count++;
+            }
+        }
+        rowBegin[t + 1] = count;
+    });
+
+    for (int t = 0; t < numThreads; t++)
+    {
+        rowBegin[t + 1] = std::min(rowBegin[t + 1] + rowBegin[t], n);
+    }
+
+    /**
+     * Each thread parses its lines into a local CSR whose rows are sorted and
+     * deduplicated on the fly. The local rows are then copied to their final
+     * place in EdgeTo.
+     */
+    std::vector<std::vector<int> > localAdjacency(numThreads);
+
+    parallelFor(numThreads, [&](int t)
+    {
+        const char *c = bounds[t];
+        std::vector<int> &adjacency = localAdjacency[t];
+        int j;
+
+        for (int i = rowBegin[t]; i < rowBegin[t + 1]; i++)
+        {
+            size_t first = adjacency.size();
+
+            while (nextInt(c, bounds[t + 1], j, true))
+            {
+                adjacency.push_back(j - 1);
+            }
+            std::sort(adjacency.begin() + first, adjacency.end());
+            adjacency.erase(std::unique(adjacency.begin() + first, adjacency.end()), adjacency.end());
+            degree[i] = adjacency.size() - first;
+            alias[i] = i + 1;
+
+            while ((c < bounds[t + 1]) && (*c++ != '\n'))
+            {
+            }
+        }
+    });
+
+    EdgesBegin = std::vector<int>(n, 0);
+    int counter = 0;
+
+    for (int i = 0; i < n; i++)
+    {
+        EdgesBegin[i] = counter;
+        counter += degree[i];
+    }
+    m = counter / 2;
+    EdgeTo = std::vector<int>(counter);
+
+    parallelFor(numThreads, [&](int t)
+    {
+        if (rowBegin[t] < rowBegin[t + 1])
+        {
+            std::copy(localAdjacency[t].begin(), localAdjacency[t].end(), EdgeTo.begin() + EdgesBegin[rowBegin[t]]);
+        }
+        std::vector<int>().swap(localAdjacency[t]);
+    });
+}
+
+int Graph::bucketPeeling(
+    int first)
+{
+    std::vector<int> buckets(Delta + 1, 0);
+    std::vector<int> vertices(ordering.begin() + first, ordering.end());
+
+    /**
+     * This code generates the initial state of the buckets based on the degree
+     * of the vertices.
+     */
+    for (int v : vertices)
+    {
+        buckets[rightDegree[v]]++;
+    }
+
+    int temp;
+    int count = first;
+
+    for (int k = 0; k < Delta + 1; k++)
+    {
+        temp = buckets[k];
+        buckets[k] = count;
+        count += temp;
+    }
+
+    for (int v : vertices)
+    {
+        position[v] = buckets[rightDegree[v]];
+        ordering[position[v]] = v;
+        buckets[rightDegree[v]]++;
+    }
+
+    for (int k = Delta; k > 0; k--)
+    {
+        buckets[k] = buckets[k - 1];
+    }
+    buckets[0] = first;
+
+    int dRegular = -1;
+    int minV;
+
+    for (int i = first; i < n; i++)
+    {
+        /**
+         * The position of the vertex with the current min degree is obtained
+         * and the corresponding vertex v is added to the degeneracy ordering.
+         * The degeneracy is updated in case the degree of the vertex is bigger
+         * than the previous d.
+         */
+        minV = ordering[i];
+        buckets[rightDegree[minV]]++;
+
+        if (rightDegree[minV] > d)
+        {
+            d = rightDegree[minV];
+            if (rightDegree[ordering[n - 1]] == d)
+            {
+                dRegular = i;
+            }
+        }
+
+        /**
+         * If the current degree of the vertex that is being removed is equal to
+         * the number of vertices left in the graph, those vertices induce a clique
+         * whose size can be used as a lower bound.
+         */
+        if ((cliqueLB == 0) && (rightDegree[ordering[i]] == n - i - 1))
+        {
+            cliqueLB = rightDegree[ordering[i]] + 1;
+        }
+
+        /**
+         * This part of the code iterates over the neighbors to the right and
+         * of the vertex being removed and reduces their degree by one
+         */
+        for (int j = EdgesBegin[minV]; j < degree[minV] + EdgesBegin[minV]; j++)
+        {
+            int neighbor = EdgeTo[j];
+
+            /**
+             * If the neighbor has not been removed, updates its degree and
+             * bucket
+             */
+            if (position[neighbor] > position[minV])
+            {
+                if (rightDegree[neighbor] == rightDegree[minV])
+                {
+                    if (neighbor != ordering[buckets[rightDegree[minV]]])
+                    {
+                        int pu = buckets[rightDegree[minV]];
+                        int u = ordering[pu];
+                        ordering[pu] = neighbor;
+                        ordering[position[neighbor]] = u;
+                        position[u] = position[neighbor];
+                        position[neighbor] = pu;
+                    }
+                    buckets[rightDegree[minV] - 1] = position[minV] + 1;
+                    buckets[rightDegree[neighbor]]++;
+                    rightDegree[neighbor]--;
+                }
+                else
+                {
+                    int pu = buckets[rightDegree[neighbor]];
+                    int u = ordering[pu];
+
+                    if (neighbor != u)
+                    {
+                        ordering[pu] = neighbor;
+                        ordering[position[neighbor]] = u;
+                        position[u] = position[neighbor];
+                        position[neighbor] = pu;
+                    }
+                    buckets[rightDegree[neighbor]]++;
+                    rightDegree[neighbor]--;
+                }
+            }
+        }
+    }
+    return dRegular;
+}
+
+int Graph::parallelPeeling()
+{
+    ThreadPool pool(numThreads);
+    std::vector<std::atomic<int> > current(n);
+    std::vector<int> remaining(n);
+    std::vector<int> frontier;
+    std::vector<std::vector<int> > found(numThreads);
+    std::vector<std::vector<int> > kept(numThreads);
+    std::vector<int> maxDegree(numThreads);
+    std::vector<int> minDegree(numThreads);
+    int dRegular = -1;
+    int placed = 0;
+    int tail = n;
+    int k = 0;
+
+    pool.run([&](int t)
+    {
+        for (long long v = sliceBegin(n, t, numThreads); v < sliceBegin(n, t + 1, numThreads); v++)
+        {
+            current[v].store(degree[v], std::memory_order_relaxed);
+            position[v] = -1;
+            remaining[v] = v;
+        }
+    });
+
+    while (placed < n)
+    {
+        /**
+         * The last vertices are removed by the sequential peeling, which finds
+         * the clique formed by the last vertices of the ordering (if any). The
+         * degrees are exact between levels.
+         */
+        if (n - placed <= minParallelPeeling)
+        {
+            int count = placed;
+
+            for (int v : remaining)
+            {
+                if (position[v] == -1)
+                {
+                    ordering[count++] = v;
+                    rightDegree[v] = current[v].load(std::memory_order_relaxed);
+                }
+            }
+            tail = placed;
+            int tailRegular = bucketPeeling(placed);
+            dRegular = (tailRegular != -1) ? tailRegular : dRegular;
+            break;
+        }
+
+        /**
+         * The remaining vertices with the current min degree k form the first
+         * frontier of the level. The others are kept for the next level.
+         */
+        pool.run([&](int t)
+        {
+            found[t].clear();
+            kept[t].clear();
+            maxDegree[t] = 0;
+            minDegree[t] = INT_MAX;
+
+            for (long long i = sliceBegin(remaining.size(), t, numThreads); i < sliceBegin(remaining.size(), t + 1, numThreads); i++)
+            {
+                int v = remaining[i];
+
+                if (position[v] != -1)
+                {
+                    continue;
+                }
+                int degreeV = current[v].load(std::memory_order_relaxed);
+                maxDegree[t] = std::max(maxDegree[t], degreeV);
+                minDegree[t] = std::min(minDegree[t], degreeV);
+                (degreeV <= k ? found[t] : kept[t]).push_back(v);
+            }
+        });
+
+        int levelMax = *std::max_element(maxDegree.begin(), maxDegree.end());
+        int levelMin = *std::min_element(minDegree.begin(), minDegree.end());
+        frontier.clear();
+        remaining.clear();
+
+        for (int t = 0; t < numThreads; t++)
+        {
+            frontier.insert(frontier.end(), found[t].begin(), found[t].end());
+            remaining.insert(remaining.end(), kept[t].begin(), kept[t].end());
+        }
+
+        if (frontier.empty())
+        {
+            k = levelMin;
+            continue;
+        }
+
+        /**
+         * As in the sequential version, the d-core is d-regular if, when the
+         * level of d starts, all the remaining vertices have degree d.
+         */
+        if (k > d)
+        {
+            d = k;
+
+            if (levelMax == k)
+            {
+                dRegular = placed;
+            }
+        }
+
+        /**
+         * Removes the frontier and decreases the degrees of the neighbors that
+         * have not been removed. The neighbors whose degree drops to k are the
+         * next frontier of the level. A decrease that would take a degree
+         * below k is undone, as that vertex is already in a frontier.
+         */
+        while (!frontier.empty())
+        {
+            pool.run([&](int t)
+            {
+                found[t].clear();
+
+                for (long long i = sliceBegin(frontier.size(), t, numThreads); i < sliceBegin(frontier.size(), t + 1, numThreads); i++)
+                {
+                    int v = frontier[i];
+                    ordering[placed + i] = v;
+                    position[v] = placed + i;
+
+                    for (int j = EdgesBegin[v]; j < degree[v] + EdgesBegin[v]; j++)
+                    {
+                        std::atomic<int> &degreeU = current[EdgeTo[j]];
+
+                        if (degreeU.load(std::memory_order_relaxed) > k)
+                        {
+                            int previous = degreeU.fetch_sub(1, std::memory_order_relaxed);
+
+                            if (previous == k + 1)
+                            {
+                                found[t].push_back(EdgeTo[j]);
+                            }
+                            else if (previous <= k)
+                            {
+                                degreeU.fetch_add(1, std::memory_order_relaxed);
+                            }
+                        }
+                    }
+                }
+            });
+
+            placed += frontier.size();
+            frontier.clear();
+
+            for (int t = 0; t < numThreads; t++)
+            {
+                frontier.insert(frontier.end(), found[t].begin(), found[t].end());
+            }
+        }
+    }
+
+    /**
+     * The right degrees of the vertices removed in parallel are counted once
+     * the ordering is complete, as the vertices of a frontier are removed at
+     * the same time.
+     */
+    pool.run([&](int t)
+    {
+        for (long long v = sliceBegin(n, t, numThreads); v < sliceBegin(n, t + 1, numThreads); v++)
+        {
+            if (position[v] >= tail)
+            {
+                continue;
+            }
+            int count = 0;
+
+            for (int j = EdgesBegin[v]; j < degree[v] + EdgesBegin[v]; j++)
+            {
+                count += (position[EdgeTo[j]] > position[v]);
+            }
+            rightDegree[v] = count;
+        }
+    });
+
+    /**
+     * If the last level was too large for the sequential peeling, the lower
+     * bound is the largest suffix of the ordering that induces a clique, i.e.,
+     * in which every vertex is adjacent to all the later ones.
+     */
+    if (tail == n)
+    {
+        while ((cliqueLB < n) && (rightDegree[ordering[n - 1 - cliqueLB]] == cliqueLB))
+        {
+            cliqueLB++;
+        }
+    }
+    return dRegular;
+}
+
+void Graph::computeDegeneracyOrdering()
+{
+    /**
+     * If the subgraph induced by the d-core is d-regular, dRegular will store
+     * the position of the first vertex of the d-core in the degerenracy ordering.
+     */
+    int dRegular = -1;
+    cliqueLB = 0;
+    d = 0;
+
+    if ((numThreads > 1) && (n >= minParallelPeeling))
+    {
+        dRegular = parallelPeeling();
+    }
+    else
+    {
+        for (int i = 0; i < n; i++)
+        {
+            ordering[i] = i;
+            rightDegree[i] = degree[i];
+        }
+        dRegular = bucketPeeling(0);
+    }
+
+    cliqueUB = d + 1;
+
+    if ((dRegular > 0) && (cliqueLB < cliqueUB))
+    {
+        bool clique = false;
+        std::vector<int> S(n);
+        int head = 0;
+        int tail = 0;
+        std::vector<bool> discovered(n, false);
+
+        for (std::vector<int>::iterator i = ordering.begin() + dRegular; i < ordering.end(); i++)
+        {
+            int count = 0;
+            S[tail++] = *i;
+            discovered[*i] = true;
+            count++;
+
+            while (head < tail)
+            {
+                int v = S[head++];
+
+                for (int j = EdgesBegin[v]; j < degree[v] + EdgesBegin[v]; j++)
+                {
+                    if ((position[EdgeTo[j]] > dRegular) && !discovered[EdgeTo[j]])
+                    {
+                        discovered[EdgeTo[j]] = true;
+                        S[tail++] = EdgeTo[j];
+                        count++;
+                    }
+                }
+            }
+
+            if (count == d + 1)
+            {
+                clique = true;
+                break;
+            }
+        }
+
+        if (!clique)
+        {
+            cliqueUB = d;
+        }
+    }
+    ordered = true;
+}
+
+void Graph::rightNeighborsFirst()
+{
+    if (rightFirst)
+    {
+        return;
+    }
+    std::vector<int> left;
+
+    for (int v = 0; v < n; v++)
+    {
+        /**
+         * Stable partition of the (sorted) adjacency list of v.
+         */
+        int *list = EdgeTo.data() + EdgesBegin[v];
+        int numRight = 0;
+        left.clear();
+
+        for (int j = 0; j < degree[v]; j++)
+        {
+            if (position[list[j]] > position[v])
+            {
+                list[numRight++] = list[j];
+            }
+            else
+            {
+                left.push_back(list[j]);
+            }
+        }
+        std::copy(left.begin(), left.end(), list + numRight);
+    }
+    rightFirst = true;
+}
+
+void Graph::relabel()
+{
+    if (relabeled)
+    {
+        return;
+    }
+    std::vector<int> newDegree(n);
+    std::vector<int> newRightDegree(n);
+    std::vector<int> newAlias(n);
+    std::vector<int> newBegin(n, 0);
+
+    for (int i = 0; i < n; i++)
+    {
+        newDegree[i] = degree[ordering[i]];
+        newRightDegree[i] = rightDegree[ordering[i]];
+        newAlias[i] = alias[ordering[i]];
+
+        if (i > 0)
+        {
+            newBegin[i] = newBegin[i - 1] + newDegree[i - 1];
+        }
+    }
+
+    /**
+     * The new vertices u are visited in increasing order and appended to the
+     * rows of their neighbors, so every row is built sorted: the neighbors
+     * w > u of u go to the front part of the row of w when u is larger and to
+     * its back part otherwise.
+     */
+    std::vector<int> frontCursor(newBegin);
+    std::vector<int> backCursor(n);
+
+    for (int u = 0; u < n; u++)
+    {
+        backCursor[u] = newBegin[u] + newRightDegree[u];
+    }
+    std::vector<int> newEdgeTo(EdgeTo.size());
+
+    for (int u = 0; u < n; u++)
+    {
+        int v = ordering[u];
+
+        for (int j = EdgesBegin[v]; j < EdgesBegin[v] + degree[v]; j++)
+        {
+            int w = position[EdgeTo[j]];
+
+            if (u > w)
+            {
+                newEdgeTo[frontCursor[w]++] = u;
+            }
+            else
+            {
+                newEdgeTo[backCursor[w]++] = u;
+            }
+        }
+    }
+    EdgeTo.swap(newEdgeTo);
+    EdgesBegin.swap(newBegin);
+    degree.swap(newDegree);
+    rightDegree.swap(newRightDegree);
+    alias.swap(newAlias);
+
+    for (int i = 0; i < n; i++)
+    {
+        ordering[i] = i;
+        position[i] = i;
+    }
+    rightFirst = true;
+    relabeled = true;
+}
+
+void Graph::rightNeighborhood(
+    int v,
+    subgraph &sG)
+{
+    /**
+     * The vertex set of the subgraph of v is v followed by its neighbors to the
+     * right in the ordering, in the same (sorted) order of its adjacency list.
+     * This helps to generate the adjacency lists efficiently later.
+     */
+    sG.n = rightDegree[v] + 1;
+    sG.m = 0;
+    sG.vertices = std::vector<vertex>(rightDegree[v] + 1);
+    sG.vertices[0].v = v;
+    sG.vertices[0].degree = 0;
+    sG.vertices[0].pos = 0;
+
+    for (int j = 0; j < rightDegree[v]; j++)
+    {
+        sG.vertices[j + 1].v = EdgeTo[EdgesBegin[v] + j];
+        sG.vertices[j + 1].degree = 0;
+        sG.vertices[j + 1].pos = j + 1;
+    }
+}
+
+void Graph::degeneracyOrdering()
+{
+    std::chrono::high_resolution_clock::time_point begin_time = std::chrono::high_resolution_clock::now();
+    computeDegeneracyOrdering();
+
+    std::chrono::high_resolution_clock::time_point end_time = std::chrono::high_resolution_clock::now();
+    std::chrono::duration<double> degeneracyTime = std::chrono::duration_cast<std::chrono::duration<double> >(end_time - begin_time);
+
+    std::clog << "Degeneracy: " << d << "\n";
+    std::clog << "Order: [";
+
+    for (int j = 0; j < n; j++)
+    {
+        std::clog << alias[ordering[j]] << " ";
+    }
+    std::clog << "]\n";
+    std::clog << "Right Degree: [\n";
+
+    for (int j = 0; j < n; j++)
+    {
+        std::clog << alias[j] << ": " << rightDegree[j] << "\n";
+    }
+    std::clog << "]\n";
+    std::clog << "Position: [\n";
+
+    for (int j = 0; j < n; j++)
+    {
+        std::clog << alias[j] << ": " << position[j] << "\n";
+    }
+    std::clog << "]\n";
+    std::clog << "Degeneracy running time: " << degeneracyTime.count() << "\n";
+    std::clog << "-------------------------------------------------------------\n";
+}
+
+void Graph::mergeComplement(
+    subgraph &sG,
+    std::vector<uint64_t> &incMat,
+    int words)
+{
+    for (std::vector<vertex>::iterator i = sG.vertices.begin() + 1; i < sG.vertices.end(); i++)
+    {
+        /**
+         * If the graph is relabeled, the vertices after i are exactly the ones
+         * to its right, so the others are not visited.
+         */
+        std::vector<vertex>::iterator current1 = sG.vertices.begin() + 1;
+
+        if (relabeled)
+        {
+            current1 = i + 1;
+        }
+        const int *current2 = EdgeTo.data() + EdgesBegin[i->v];
+        const int *end2 = current2 + rightDegree[i->v];
+        while (current1 != sG.vertices.end() && current2 != end2)
+        {
+            if (*current2 < current1->v)
+            {
+                current2++;
+                continue;
+            }
+            if (current1->v == *current2)
+            {
+                current1++;
+                current2++;
+                continue;
+            }
+            if (current1->v == i->v)
+            {
+                current1++;
+                continue;
+            }
+            if (current1->v < *current2)
+            {
+                if (relabeled || (position[i->v] < position[current1->v]))
+                {
+                    Bitset::set(&incMat[i->pos * words], current1->pos);
+                    Bitset::set(&incMat[current1->pos * words], i->pos);
+                    i->degree++;
+                    current1->degree++;
+                    sG.m++;
+                }
+                current1++;
+                continue;
+            }
+        }
+        while (current1 != sG.vertices.end())
+        {
+            if (relabeled || (position[i->v] < position[current1->v]))
+            {
+                Bitset::set(&incMat[i->pos * words], current1->pos);
+                Bitset::set(&incMat[current1->pos * words], i->pos);
+                i->degree++;
+                current1->degree++;
+                sG.m++;
+            }
+            current1++;
+            continue;
+        }
+    }
+}
+
+void Graph::intersectComplement(
+    subgraph &sG,
+    std::vector<uint64_t> &incMat,
+    int words)
+{
+    /**
+     * ids holds the names of the vertices of the subgraph but the root, which
+     * are the right neighbors of the root in the (sorted) order of its row of
+     * EdgeTo. The vertices are visited in the order of their positions, and
+     * later has the vertices not visited yet. Every pair is decided by the
+     * vertex that comes first: its right neighbors are intersected with ids
+     * (@see SortedSet::markCommon), and the vertices of later that are not
+     * among them are its neighbors in the complement. If the graph is
+     * relabeled, the ids are the positions, so only the suffix of ids after
+     * the vertex is intersected.
+     */
+    int numIds = sG.n - 1;
+    const int *ids = EdgeTo.data() + EdgesBegin[sG.vertices[0].v];
+    std::vector<int> visit;
+
+    if (!relabeled)
+    {
+        visit.resize(numIds);
+
+        for (int p = 0; p < numIds; p++)
+        {
+            visit[p] = p + 1;
+        }
+        std::sort(visit.begin(), visit.end(), [this, &sG](int a, int b) { return position[sG.vertices[a].v] < position[sG.vertices[b].v]; });
+    }
+    std::vector<uint64_t> sets(2 * words, 0);
+    uint64_t *later = sets.data();
+    uint64_t *adjacent = later + words;
+
+    for (int p = 1; p < sG.n; p++)
+    {
+        Bitset::set(later, p);
+    }
+
+    for (int k = 0; k < numIds; k++)
+    {
+        int p = k + 1;
+
+        if (!relabeled)
+        {
+            p = visit[k];
+        }
+        vertex &i = sG.vertices[p];
+        const int *row = EdgeTo.data() + EdgesBegin[i.v];
+        uint64_t *comp = &incMat[p * words];
+        Bitset::reset(later, p);
+        std::fill(adjacent, adjacent + words, 0);
+
+        if (relabeled)
+        {
+            SortedSet::markCommon(ids + p, numIds - p, row, rightDegree[i.v], p + 1, adjacent);
+        }
+        else
+        {
+            SortedSet::markCommon(ids, numIds, row, rightDegree[i.v], 1, adjacent);
+        }
+
+        for (int w = 0; w < words; w++)
+        {
+            uint64_t word = later[w] & ~adjacent[w];
+            comp[w] |= word;
+
+            for (; word != 0; word &= word - 1)
+            {
+                int q = w * 64 + __builtin_ctzll(word);
+                Bitset::set(&incMat[q * words], p);
+                i.degree++;
+                sG.vertices[q].degree++;
+                sG.m++;
+            }
+        }
+    }
+}
+
+void Graph::generateCompGraphRightNeighbors(
+    int v,
+    subgraph &sG,
+    bool bitsets)
+{
+    /**
+     * The following code populates the std::vector of right neighboors of v in
+     * the degeneracy ordering. The std::vector includes v as well.
+     */
+    rightNeighborhood(v, sG);
+    sG.created = true;
+
+    /**
+     * The following code finds, for each pair of vertices in the subgraph, if
+     * they are adjacent in G. If not, it adds the corresponding edge to the
+     * subgraph.
+     *
+     * See G. Manoussakis. New algorithms for cliques and related structures in k-degenerate graphs. arXiv preprint arXiv:1501.01819v4, 2016
+     */
+    int words = Bitset::numWords(sG.n);
+    std::vector<uint64_t> incMat(sG.n * words, 0);
+
+    if (sG.n < minIntersection)
+    {
+        mergeComplement(sG, incMat, words);
+    }
+    else
+    {
+        intersectComplement(sG, incMat, words);
+    }
+    int largestDegree = -1;
+
+    for (std::vector<vertex>::iterator i = sG.vertices.begin() + 1; i < sG.vertices.end(); i++)
+    {
+        if (i->degree > largestDegree)
+        {
+            largestDegree = i->degree;
+            sG.largestDegreeVertex = i->pos;
+        }
+    }
+    if (bitsets)
+    {
+        sG.words = words;
+        sG.rows.swap(incMat);
+        return;
+    }
+    sG.adjLists = std::vector<std::vector<int> >(sG.n);
+
+    for (std::vector<vertex>::iterator i = sG.vertices.begin() + 1; i < sG.vertices.end(); i++)
+    {
+        sG.adjLists[i->pos].reserve(i->degree);
+
+        for (int w = 0; w < words; w++)
+        {
+            for (uint64_t word = incMat[i->pos * words + w]; word != 0; word &= word - 1)
+            {
+                sG.adjLists[i->pos].push_back(w * 64 + __builtin_ctzll(word));
+            }
+        }
+    }
+}
+
+void Graph::clearElements()
+{
+    std::vector<int>().swap(EdgeTo);
+    std::vector<int>().swap(EdgesBegin);
+    std::vector<int>().swap(degree);
+    std::vector<int>().swap(alias);
+    std::vector<int>().swap(rightDegree);
+    std::vector<int>().swap(ordering);
+}
+
+void Graph::print()
+{
+    printShort();
+    std::clog << "\n";
+
+    for (int i = 0; i < n; i++)
+    {
+        std::clog << alias[i] << "(" << degree[i] << "): ";
+
+        for (int j = EdgesBegin[i]; j < degree[i] + EdgesBegin[i]; j++)
+        {
+            std::clog << alias[EdgeTo[j]] << " ";
+        }
+        std::clog << std::endl;
+    }
+    std::clog << std::endl;
+}
+
+void Graph::printShort(
+    std::ostream &out)
+{
+    out << "-------------------------------------------------------------\n";
+    out << "Filename: " << name << "\nn: " << n << "\nm: " << m <<
+    "\ndelta: " << delta << "\nDelta: " << Delta << "\nReading time: " <<
+    readTime.count() << "\n";
+    out << "-------------------------------------------------------------\n";
+}
@@ -0,0 +1,438 @@
+/**@file  Graph.h
+ *
+ * @brief  Graph represesentation class consisting of the adjacency lists of its
+ * vertices.
+ *
+ * @details This class reads either a standard edge type file or an adjacency
+ * lists file (@see Graph::Graph for details). The Graph class also implements a
+ * procedure that generates a degeneracy ordering of the given graph
+ * (@see Graph::degeneracyOrdering)and a procedure that outputs the complement
+ * of the subgraph induced by a given vertex v and it's neighbors to the right
+ * in the degeneracy ordering.
+ *
+ * @author Jose L. Walteros
+ *
+ * @version   1.0
+ * @date      June 2018
+ *
+ * Copyright (C) 2018 Jose L. Walteros. All rights reserved.
+ *
+ *---+----+----+----+----+----+----+----+----+----+----+----+----+----+----+----*/
+#ifndef _GRAPH_H_
+#define _GRAPH_H_
+
+#include <cstdint>
+#include <string>
+#include <sstream>
+#include <iostream>
+#include <vector>
+#include <chrono>
+
+/**
+ * vertex structure. The name of the vertex is generaly different to its
+ * possition in the vertex list.
+ */
+struct vertex
+{
+    int v; /**< Vertex name */
+    int degree; /**< Vertex's degree */
+    int pos; /**< Position of the vertex in the vector of vertices */
+
+    /**
+     * Comparator
+     */
+    friend bool operator<(const vertex &x, const vertex &y)
+    {
+        return x.v < y.v;
+    }
+};
+
+/**
+ * Step of the reconstruction of a vertex cover. Either v is in the cover
+ * (a = b = -1) or v was folded with its neighbors a and b, in which case the
+ * cover has a and b if it has v and v otherwise (@see VertexCover::coverFound).
+ * The vertices are given by their names.
+ */
+struct coverStep
+{
+    int v; /**< Vertex in the cover or folded vertex */
+    int a; /**< First neighbor of a folded vertex (-1 if none) */
+    int b; /**< Second neighbor of a folded vertex (-1 if none) */
+};
+
+/**
+ * subgraph structure.
+ */
+struct subgraph
+{
+    int n; /**< Number of vertices in the subgraph */
+    int m; /**< Number of edges in the subgraph */
+    bool created = false; /**< Whether the subgraph is empty*/
+    int LB; /**< lower bound on the max clique value*/
+    int UB; /**< upper bound on the max clique value*/
+    std::vector<vertex> vertices; /**< Set of vertices of the subgraph */
+    std::vector<std::vector<int> > adjLists; /**< Adj. lists of the vertices */
+    int largestDegreeVertex; /**< Index of the vertex with the largest degree */
+    int words = 0; /**< Words per row of the bitset representation */
+    std::vector<uint64_t> rows; /**< Adjacency matrix of the subgraph, one bitset
+    * of Subgraph::words words per vertex (only for the bitset backend,
+    * @see BitsetVertexCover) */
+};
+
+class Graph
+{
+public:
+    const char *name; /**< Graph's name (filename) */
+    int n; /**< Number of vertices in G */
+    int m; /**< Number of edges in G*/
+    int delta; /**< Min degree */
+    int Delta; /**< Max degree */
+    std::vector<int> EdgeTo; /**< Vector that contains the adjacency list of each
+    * Vertex. The lists are appended one after the other */
+    std::vector<int> EdgesBegin; /**< The position of the first neighbor of each vertex */
+    std::vector<int> degree; /**< Degree of the vertices */
+    std::vector<int> alias; /**< Name of the vertices */
+    std::chrono::duration<double> readTime; /**< ReadingTime */
+
+    /*
+     * Members generated after the degeneray ordering is calculated
+     */
+    int d; /**<  Degeneracy value */
+    int cliqueLB; /**< Clique size given by the degeneracy ordering. Obtained when the
+    * rightDegree of a vertex equals to the number of vertices to the right
+    * in the degeneracy ordering */
+    int cliqueUB; /**< Upper bound on the clique. Is d+1 normally, but will be set to d if the
+                   * d-core is d-regular but does not have a component of size d*/
+    std::vector<int> rightDegree; /**<  Number of neighbors to the right in the ordering */
+    std::vector<int> ordering; /**< Degeneracy ordering */
+    std::vector<int> position; /**< Position of the vertices in the ordering */
+    bool ordered = false; /**< Whether the members above have been computed
+    * (or read from a snapshot) */
+    int numThreads = 1; /**< Number of threads used by the degeneracy ordering */
+    static const int minParallelPeeling = 4096; /**< Smallest graph for which the
+    * degeneracy ordering is computed in parallel */
+    bool rightFirst = false; /**< Whether the right neighbors are at the front of
+    * the adjacency lists (@see Graph::rightNeighborsFirst) */
+    bool relabeled = false; /**< Whether the id of every vertex is its position
+    * in the ordering (@see Graph::relabel) */
+    static const int minIntersection = 24; /**< Smallest subgraph whose complement
+    * is built by Graph::intersectComplement instead of Graph::mergeComplement */
+    static const long long defaultStreamBudget = 1024LL << 20; /**< Default memory
+    * budget of the streaming reader, in bytes (@see StreamReader) */
+
+    /**
+     * Default constructor.
+     */
+    inline Graph() {}
+
+    /**
+     * Graph constructor: Receives a filename with the graph information to be
+     * read.The expected format is either the edge list or the adjacency lists of the
+     * graph.
+     *
+     * - Adjacency lists:
+     *   The first line of the file must include the number vertices and edges.
+     *   (i.e., 62 159). The vertices are expected to be labeled from 1 to n.
+     *
+     * - Edge list:
+     *   The fisrt line of the file must include the number vertices and edges.
+     *   (i.e., 62 159). The vertices are expected to be labeled from 0 to n-1.
+     *
+     * The types "-e" and "-a" read the file with streams. The types "-pe" and
+     * "-pa" read the same formats from a memory-mapped file that is parsed in
+     * parallel (@see Graph::readMappedFile). The type "-se" reads an edge list,
+     * which may be compressed, with bounded memory (@see StreamReader). The
+     * type "-b" reads a binary snapshot written by Snapshot::write
+     * (@see Snapshot).
+     *
+     * @param[in] type : Type of the file ("-e", "-a", "-pe", "-pa", "-se" or "-b").
+     * @param[in] filename : Name of the file with the graph's information.
+     * @param[out] read : Whether the graph was read successfully.
+     * @param[in] numThreads : Number of threads used by the parallel reader and the
+     * degeneracy ordering.
+     * @param[in] streamBudget : Bytes that the streaming reader can use besides
+     * the adjacency lists.
+     */
+    Graph(
+        const char *type,
+        const char *filename,
+        bool &read,
+        int numThreads = 1,
+        long long streamBudget = defaultStreamBudget);
+
+    /**
+     * Graph constructor from edges in memory: edge e joins tails[e] and
+     * heads[e]. The vertices are 0, ..., n - 1 and keep their names. Loops and
+     * duplicated edges are filtered as in the file readers.
+     *
+     * @param[in] n : Number of vertices.
+     * @param[in] tails : First endpoint of every edge.
+     * @param[in] heads : Second endpoint of every edge.
+     * @param[in] numEdges : Number of edges.
+     * @param[out] read : Whether the edges were valid.
+     * @param[in] numThreads : Number of threads used to build the adjacency
+     * lists and by the degeneracy ordering.
+     */
+    Graph(
+        int n,
+        const int *tails,
+        const int *heads,
+        long long numEdges,
+        bool &read,
+        int numThreads = 1);
+
+    /**
+     * Graph constructor from adjacency lists in CSR form: the neighbors of
+     * vertex i are adjacency[offsets[i]], ..., adjacency[offsets[i + 1] - 1].
+     * The rows must be sorted and the graph undirected and without loops or
+     * duplicated edges. The arrays are moved into the graph, not copied (they
+     * are left empty if the graph is built).
+     *
+     * @param[in] offsets : Beginning of the rows (n + 1 entries).
+     * @param[in] adjacency : Rows, one after the other.
+     * @param[out] read : Whether the arrays were a valid CSR.
+     * @param[in] numThreads : Number of threads used by the degeneracy ordering.
+     */
+    Graph(
+        std::vector<int> &&offsets,
+        std::vector<int> &&adjacency,
+        bool &read,
+        int numThreads = 1);
+
+    /**
+     * Parallel reader: Memory-maps the file, splits it into one chunk per
+     * thread and parses the chunks concurrently. The adjacency lists are built
+     * directly in CSR form with a counting pass followed by a sort-and-unique
+     * of each row, so no std::set or std::map is needed.
+     *
+     * The resulting graph is the same as the one built by the stream reader:
+     * loops and duplicated edges are filtered for edge lists, duplicated
+     * neighbors are filtered for adjacency lists, and the vertices of an edge
+     * list are renamed in order of first appearance (alias keeps the names).
+     *
+     * @param[in] type : Type of the file ("-pe" or "-pa").
+     * @param[in] filename : Name of the file with the graph's information.
+     * @param[in] numThreads : Number of threads to use.
+     * @param[out] read : Whether the graph was read successfully.
+     */
+    void readMappedFile(
+        const char *type,
+        const char *filename,
+        int numThreads,
+        bool &read);
+
+    /**
+     * Builds the CSR arrays from the edges of a mapped edge list.
+     * @param[in] begin : First byte after the header.
+     * @param[in] end : End of the file.
+     * @param[in] numThreads : Number of threads to use.
+     * @param[out] read : Whether the graph was read successfully.
+     */
+    void readMappedEdgeList(
+        const char *begin,
+        const char *end,
+        int numThreads,
+        bool &read);
+
+    /**
+     * Builds the CSR arrays from the lines of a mapped adjacency lists file.
+     * @param[in] begin : First byte after the header line.
+     * @param[in] end : End of the file.
+     * @param[in] numThreads : Number of threads to use.
+     */
+    void readMappedAdjacencyLists(
+        const char *begin,
+        const char *end,
+        int numThreads);
+
+    /**
+     * Sorts and deduplicates the rows of raw, which begin at rawBegin, and
+     * copies them into the CSR arrays (EdgeTo, EdgesBegin and degree).
+     * @param[in] raw : Rows, which may have duplicates.
+     * @param[in] rawBegin : Beginning of the rows of raw (n + 1 entries).
+     * @param[in] numThreads : Number of threads to use.
+     */
+    void compactRows(
+        std::vector<int> &raw,
+        const std::vector<int> &rawBegin,
+        int numThreads);
+
+    /**
+     * Computes delta and Delta and allocates the members of the degeneracy
+     * ordering, once the CSR arrays are built.
+     */
+    void finishCSR();
+
+    /**
+     * This procedure generates the degeneracy ordering of the graph (Matula and
+     * Beck (1983)). This procedure is used by the clique finding algorithms.
+     *
+     * This code also calculates a lower and and upper bound on the maximum
+     * clique size (i.e., the LB results from sequentially removing low degree
+     * vertices until the residual graph is a clique; UB is set as d+1)
+     *
+     * The code identifies whether the d-core is d-regular.
+     *
+     * With more than one thread and at least Graph::minParallelPeeling
+     * vertices, the ordering is computed by Graph::parallelPeeling instead of
+     * Graph::bucketPeeling.
+     */
+    void computeDegeneracyOrdering();
+
+    /**
+     * Sequential bucket peeling: removes a vertex of minimum degree at a time.
+     * Computes ordering, position, rightDegree, d and cliqueLB (d and cliqueLB
+     * must be initialized by the caller).
+     *
+     * @param[in] first : The vertices ordering[first], ..., ordering[n - 1]
+     * are peeled. Their rightDegree must be their degree in the graph induced
+     * by them, and the other vertices must be at positions before first.
+     *
+     * @returns the position of the first vertex of the d-core if it is
+     * d-regular, and -1 otherwise.
+     */
+    int bucketPeeling(
+        int first);
+
+    /**
+     * Parallel level-synchronous peeling (in the spirit of ParK, Dasari et
+     * al. (2014)). The levels k are processed in increasing order. Every level
+     * removes, in rounds, all the vertices of degree k at the same time: the
+     * threads split the frontier and decrease the degrees of the neighbors
+     * with atomic operations, and the neighbors that reach degree k form the
+     * frontier of the next round. Every vertex has at most k neighbors after
+     * it when it is removed, so the largest level is the degeneracy. The
+     * ordering is a valid degeneracy ordering, but it is not necessarily the
+     * one of Graph::bucketPeeling. The last Graph::minParallelPeeling vertices
+     * (at least) are removed by Graph::bucketPeeling, which also finds the
+     * clique at the end of the ordering. Computes the same members.
+     *
+     * @returns the position of the first vertex of the d-core if it is
+     * d-regular, and -1 otherwise.
+     */
+    int parallelPeeling();
+
+    /**
+     * Moves the neighbors to the right in the ordering to the front of the
+     * adjacency list of every vertex (without changing their relative, sorted,
+     * order). Afterwards, the right neighbors of v are
+     * EdgeTo[EdgesBegin[v]], ..., EdgeTo[EdgesBegin[v] + rightDegree[v] - 1],
+     * which is what the subgraphs are generated from.
+     */
+    void rightNeighborsFirst();
+
+    /**
+     * Renames the vertices so that the id of every vertex is its position in
+     * the ordering, and permutes the CSR arrays, rightDegree and alias
+     * accordingly. The right neighbors of v are then the neighbors with ids
+     * larger than v, which are kept sorted at the front of its adjacency list
+     * (as Graph::rightNeighborsFirst does), followed by the left ones. The
+     * subgraphs of consecutive vertices of the ordering use nearby rows, and
+     * Graph::generateCompGraphRightNeighbors compares ids instead of
+     * positions. The ordering must have been computed. Uses a second copy of
+     * EdgeTo while it runs.
+     */
+    void relabel();
+
+    /**
+     * Populates the vertex set of the subgraph induced by the closed right
+     * neighborhood of v: v followed by its right neighbors. The ordering must
+     * have been computed and Graph::rightNeighborsFirst called.
+     *
+     * @param[in] v : Vertex.
+     * @param[out] sG : Subgraph of v.
+     */
+    void rightNeighborhood(
+        int v,
+        subgraph &sG);
+
+
+    /**
+     * This procedure generates the degeneracy ordering of the graph (Matula and
+     * Beck (1983)).
+     */
+    void degeneracyOrdering();
+
+    /**
+     * Generates the complement graph induced by the closed right neighborhood
+     * of v (@see Graph::rightNeighborhood).
+     * @param[in] v : The node for which \bar G[v] will be created
+     * @param[out] sG : the corresponding subgraph \bar G[v].
+     * @param[in] bitsets : Whether the subgraph keeps its adjacency matrix as
+     * bitsets (subgraph::rows) instead of adjacency lists.
+     */
+    void generateCompGraphRightNeighbors(
+        int v,
+        subgraph &sG,
+        bool bitsets = false);
+
+    /**
+     * Sets the bits of the pairs of vertices of sG (but its root) that are not
+     * adjacent in G, and their degrees and sG.m, by merging the vertices of sG
+     * with the right neighbors of every vertex one element at a time. Used for
+     * the small subgraphs.
+     *
+     * @param[in,out] sG : Subgraph given by Graph::rightNeighborhood.
+     * @param[out] incMat : Adjacency matrix of the complement, one bitset of
+     * words words per vertex, initially empty.
+     * @param[in] words : Words per row.
+     */
+    void mergeComplement(
+        subgraph &sG,
+        std::vector<uint64_t> &incMat,
+        int words);
+
+    /**
+     * Same as Graph::mergeComplement, but the right neighbors of every vertex
+     * are intersected with the vertices of sG by SortedSet::markCommon, and
+     * its row of the complement is computed a word at a time.
+     */
+    void intersectComplement(
+        subgraph &sG,
+        std::vector<uint64_t> &incMat,
+        int words);
+
+    /**
+     * In order to reduce the memory consumption, this method clears the vectors 
+     * that are not required for finding max clique after the degeneracy ordering 
+     * is computed.
+     */
+    void clearElements();
+
+    /**
+     * Prints the full description of the graph:
+     *
+     * <name n m delta Delta>
+     * <v(name): adjacency list(v)>
+     *
+     * For example:
+     *
+     * test.graph 10 13 1 5
+     * 0(4): 1 2 3 9
+     * 1(2): 0 2
+     * 2(2): 0 1
+     * 3(5): 0 4 5 7 8
+     * 4(3): 3 5 6
+     * 5(4): 3 4 6 8
+     * 6(2): 4 5
+     * 7(1): 3
+     * 8(2): 3 5
+     * 9(1): 0
+     */
+    void print();
+
+    /**
+     * Prints a short description of graph:
+     *
+     * <name n m delta Delta>
+     *
+     * For example:
+     *
+     * test.graph 10 13 1 5
+     *
+     * @param[in] out : Stream that receives the summary.
+     */
+    void printShort(
+        std::ostream &out = std::clog);
+};
+#endif // _GRAPH_H_
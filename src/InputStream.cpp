@@ -0,0 +1,156 @@
+/**@file InputStream.cpp
+ *
+ * @brief Sequential reader of the integers of a file that may be compressed.
+ *
+ * @author Jose L. Walteros
+ *
+ * @version   1.0
+ * @date      June 2018
+ *
+ * Copyright (C) 2018 Jose L. Walteros. All rights reserved.
+ *
+ *---+----+----+----+----+----+----+----+----+----+----+----+----+----+----+----*/
+#include <climits>
+#include <cstring>
+#include <string>
+#include "InputStream.h"
+
+#if defined(_WIN32) && !defined(__CYGWIN__)
+#define popen _popen
+#define pclose _pclose
+#endif
+
+/**
+ * Whether name ends with suffix.
+ */
+static bool endsWith(
+    const std::string &name,
+    const char *suffix)
+{
+    size_t length = strlen(suffix);
+    return (name.size() > length) && (name.compare(name.size() - length, length, suffix) == 0);
+}
+
+InputStream::InputStream(
+    const char *filename) : open(false), malformed(false), file(nullptr), pipe(false), buffer(blockSize), position(0), length(0)
+{
+    std::string name(filename);
+    const char *decompressor = endsWith(name, ".gz") ? "gzip" : (endsWith(name, ".zst") ? "zstd" : (endsWith(name, ".xz") ? "xz" : nullptr));
+
+    if (decompressor == nullptr)
+    {
+        file = fopen(filename, "rb");
+    }
+    else if ((file = fopen(filename, "rb")) != nullptr)
+    {
+        /**
+         * The file exists; the name is quoted for the shell.
+         */
+        fclose(file);
+        std::string command = std::string(decompressor) + " -dc '";
+
+        for (char c : name)
+        {
+            command += (c == '\'') ? std::string("'\\''") : std::string(1, c);
+        }
+        command += "'";
+        file = popen(command.c_str(), "r");
+        pipe = true;
+    }
+    open = (file != nullptr);
+}
+
+InputStream::~InputStream()
+{
+    close();
+}
+
+bool InputStream::refill()
+{
+    position = 0;
+    length = (file != nullptr) ? fread(buffer.data(), 1, blockSize, file) : 0;
+    return length > 0;
+}
+
+bool InputStream::nextInt(
+    int &value)
+{
+    int c = peek();
+
+    while ((c == ' ') || (c == '\n') || (c == '\t') || (c == '\r') || (c == '\v') || (c == '\f'))
+    {
+        position++;
+        c = peek();
+    }
+
+    if (c < 0)
+    {
+        return false;
+    }
+
+    bool negative = (c == '-');
+
+    if (negative)
+    {
+        position++;
+        c = peek();
+    }
+
+    int x = 0;
+    int numDigits = 0;
+    bool overflow = false;
+
+    while ((c >= '0') && (c <= '9'))
+    {
+        overflow = overflow || (x > (INT_MAX - (c - '0')) / 10);
+        x = overflow ? x : 10 * x + (c - '0');
+        numDigits++;
+        position++;
+        c = peek();
+    }
+
+    /**
+     * The rest of the token, which must be empty.
+     */
+    bool trailing = false;
+
+    while ((c >= 0) && (c != ' ') && (c != '\n') && (c != '\t') && (c != '\r') && (c != '\v') && (c != '\f'))
+    {
+        trailing = true;
+        position++;
+        c = peek();
+    }
+
+    if ((numDigits == 0) || trailing || overflow)
+    {
+        malformed = true;
+        return false;
+    }
+    value = negative ? -x : x;
+    return true;
+}
+
+bool InputStream::close()
+{
+    if (file == nullptr)
+    {
+        return open;
+    }
+    bool success = !ferror(file);
+
+    if (pipe)
+    {
+        /**
+         * If the file was not read to the end, the decompressor is stopped
+         * and its exit status tells nothing.
+         */
+        bool atEnd = feof(file);
+        success = ((pclose(file) == 0) || !atEnd) && success;
+    }
+    else
+    {
+        fclose(file);
+    }
+    file = nullptr;
+    return success;
+}
@@ -0,0 +1,92 @@
+/**@file InputStream.h
+ *
+ * @brief Sequential reader of the integers of a file that may be compressed.
+ *
+ * @details The file is read in blocks of InputStream::blockSize bytes, so only
+ * one block is in memory at a time. Files whose name ends in .gz, .zst or .xz
+ * are read through the standard output of gzip, zstd or xz, which must be
+ * installed; any other file is read directly.
+ *
+ * @author Jose L. Walteros
+ *
+ * @version   1.0
+ * @date      June 2018
+ *
+ * Copyright (C) 2018 Jose L. Walteros. All rights reserved.
+ *
+ *---+----+----+----+----+----+----+----+----+----+----+----+----+----+----+----*/
+#ifndef _INPUTSTREAM_H_
+#define _INPUTSTREAM_H_
+
+#include <cstdio>
+#include <vector>
+
+class InputStream
+{
+public:
+    static const size_t blockSize = 1 << 20; /**< Bytes read at a time */
+
+    bool open; /**< Whether the file could be opened */
+    bool malformed; /**< Whether a token that is not an integer was read */
+
+    /**
+     * InputStream constructor: opens the file, or starts the decompressor
+     * of a compressed file.
+     *
+     * @param[in] filename : Name of the file.
+     */
+    InputStream(
+        const char *filename);
+
+    /**
+     * Closes the file (@see InputStream::close).
+     */
+    ~InputStream();
+
+    InputStream(const InputStream &) = delete;
+    InputStream &operator=(const InputStream &) = delete;
+
+    /**
+     * Parses the next integer token, which is an optional minus sign followed
+     * by decimal digits, with an absolute value of at most INT_MAX.
+     *
+     * @returns false at the end of the file, or if the token is not such an
+     * integer (and then InputStream::malformed is set).
+     */
+    bool nextInt(
+        int &value);
+
+    /**
+     * Closes the file.
+     *
+     * @returns false if there was a read error or the decompressor failed.
+     */
+    bool close();
+
+private:
+    FILE *file; /**< File or pipe (null once closed) */
+    bool pipe; /**< Whether file is the output of a decompressor */
+    std::vector<char> buffer; /**< Current block */
+    size_t position; /**< Next byte of the block */
+    size_t length; /**< Bytes in the block */
+
+    /**
+     * The next byte, or -1 at the end of the file.
+     */
+    inline int peek()
+    {
+        if ((position == length) && !refill())
+        {
+            return -1;
+        }
+        return (unsigned char)buffer[position];
+    }
+
+    /**
+     * Reads the next block.
+     *
+     * @returns false at the end of the file.
+     */
+    bool refill();
+};
+#endif // _INPUTSTREAM_H_
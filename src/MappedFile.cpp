@@ -0,0 +1,86 @@
+/**@file MappedFile.cpp
+ *
+ * @brief Read-only view of a whole file in memory.
+ *
+ * @details On POSIX systems the file is memory-mapped, so the pages are only
+ * brought in by the threads that parse them. On platforms without mmap the
+ * file is read into a buffer instead.
+ *
+ * @author Jose L. Walteros
+ *
+ * @version   1.0
+ * @date      June 2018
+ *
+ * Copyright (C) 2018 Jose L. Walteros. All rights reserved.
+ *
+ *---+----+----+----+----+----+----+----+----+----+----+----+----+----+----+----*/
+#include "MappedFile.h"
+
+#if defined(_WIN32) && !defined(__CYGWIN__)
+#include <fstream>
+#include <iterator>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+MappedFile::MappedFile(
+    const char *filename) : data(nullptr), size(0), open(false), mapping(nullptr)
+{
+#if defined(_WIN32) && !defined(__CYGWIN__)
+    std::ifstream file(filename, std::ios::binary);
+
+    if (file)
+    {
+        buffer.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        data = buffer.data();
+        size = buffer.size();
+        open = true;
+    }
+#else
+    int fd = ::open(filename, O_RDONLY);
+
+    if (fd < 0)
+    {
+        return;
+    }
+
+    struct stat info;
+
+    if (fstat(fd, &info) == 0)
+    {
+        open = true;
+        size = static_cast<size_t>(info.st_size);
+
+        if (size > 0)
+        {
+            void *address = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+            if (address == MAP_FAILED)
+            {
+                open = false;
+                size = 0;
+            }
+            else
+            {
+                madvise(address, size, MADV_WILLNEED);
+                mapping = address;
+                data = static_cast<const char *>(address);
+            }
+        }
+    }
+    close(fd);
+#endif
+}
+
+MappedFile::~MappedFile()
+{
+#if !defined(_WIN32) || defined(__CYGWIN__)
+    if (mapping != nullptr)
+    {
+        munmap(mapping, size);
+    }
+#endif
+}
@@ -0,0 +1,51 @@
+/**@file MappedFile.h
+ *
+ * @brief Read-only view of a whole file in memory.
+ *
+ * @details On POSIX systems the file is memory-mapped, so the pages are only
+ * brought in by the threads that parse them. On platforms without mmap the
+ * file is read into a buffer instead. Either way, the contents are exposed
+ * through @ref MappedFile::data and @ref MappedFile::size.
+ *
+ * @author Jose L. Walteros
+ *
+ * @version   1.0
+ * @date      June 2018
+ *
+ * Copyright (C) 2018 Jose L. Walteros. All rights reserved.
+ *
+ *---+----+----+----+----+----+----+----+----+----+----+----+----+----+----+----*/
+#ifndef _MAPPEDFILE_H_
+#define _MAPPEDFILE_H_
+
+#include <cstddef>
+#include <vector>
+
+class MappedFile
+{
+public:
+    const char *data; /**< First byte of the file */
+    size_t size; /**< Number of bytes in the file */
+    bool open; /**< Whether the file could be opened */
+
+    /**
+     * MappedFile constructor: maps the whole file in read-only mode.
+     *
+     * @param[in] filename : Name of the file to be mapped.
+     */
+    MappedFile(
+        const char *filename);
+
+    /**
+     * Unmaps the file.
+     */
+    ~MappedFile();
+
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+
+private:
+    void *mapping; /**< Address returned by mmap (null if none) */
+    std::vector<char> buffer; /**< File contents when mmap is not available */
+};
+#endif // _MAPPEDFILE_H_
@@ -0,0 +1,198 @@
+/**@file MpiCluster.cpp
+ *
+ * @brief Processes of an MPI job that share the clique search of a graph.
+ *
+ * @author Jose L. Walteros
+ *
+ * @version   1.0
+ * @date      June 2018
+ *
+ * Copyright (C) 2018 Jose L. Walteros. All rights reserved.
+ *
+ *---+----+----+----+----+----+----+----+----+----+----+----+----+----+----+----*/
+#include <algorithm>
+#include "MpiCluster.h"
+
+MpiCluster::MpiCluster(
+    bool &success)
+{
+    int provided = MPI_THREAD_SINGLE;
+    MPI_Init_thread(nullptr, nullptr, MPI_THREAD_SERIALIZED, &provided);
+    success = (provided >= MPI_THREAD_SERIALIZED);
+    MPI_Comm_rank(MPI_COMM_WORLD, &myRank);
+    MPI_Comm_size(MPI_COMM_WORLD, &numRanks);
+}
+
+MpiCluster::~MpiCluster()
+{
+    if (window != MPI_WIN_NULL)
+    {
+        MPI_Win_unlock_all(window);
+        MPI_Win_free(&window);
+    }
+    MPI_Finalize();
+}
+
+int MpiCluster::rank() const
+{
+    return myRank;
+}
+
+int MpiCluster::size() const
+{
+    return numRanks;
+}
+
+int MpiCluster::minimum(
+    int value)
+{
+    std::lock_guard<std::mutex> guard(lock);
+    int result = value;
+    MPI_Allreduce(&value, &result, 1, MPI_INT, MPI_MIN, MPI_COMM_WORLD);
+    return result;
+}
+
+long long MpiCluster::sum(
+    long long value)
+{
+    std::lock_guard<std::mutex> guard(lock);
+    long long result = value;
+    MPI_Allreduce(&value, &result, 1, MPI_LONG_LONG, MPI_SUM, MPI_COMM_WORLD);
+    return result;
+}
+
+int MpiCluster::largest(
+    int value,
+    std::vector<int> &items)
+{
+    std::lock_guard<std::mutex> guard(lock);
+
+    /**
+     * MPI_MAXLOC breaks the ties by the smallest rank.
+     */
+    struct
+    {
+        int value;
+        int rank;
+    } mine = {value, myRank}, best = mine;
+    MPI_Allreduce(&mine, &best, 1, MPI_2INT, MPI_MAXLOC, MPI_COMM_WORLD);
+    int numItems = items.size();
+    MPI_Bcast(&numItems, 1, MPI_INT, best.rank, MPI_COMM_WORLD);
+    items.resize(numItems);
+    MPI_Bcast(items.data(), numItems, MPI_INT, best.rank, MPI_COMM_WORLD);
+    return best.value;
+}
+
+void MpiCluster::broadcast(
+    std::vector<int> &values)
+{
+    std::lock_guard<std::mutex> guard(lock);
+    int numValues = values.size();
+    MPI_Bcast(&numValues, 1, MPI_INT, 0, MPI_COMM_WORLD);
+    values.resize(numValues);
+    MPI_Bcast(values.data(), numValues, MPI_INT, 0, MPI_COMM_WORLD);
+}
+
+void MpiCluster::beginIteration(
+    int numSizes)
+{
+    std::lock_guard<std::mutex> guard(lock);
+    this->numSizes = numSizes;
+
+    /**
+     * The window is created again (by every process) when it is too small.
+     */
+    if (numSizes > capacity)
+    {
+        if (window != MPI_WIN_NULL)
+        {
+            MPI_Win_unlock_all(window);
+            MPI_Win_free(&window);
+        }
+        capacity = numSizes;
+        memory.assign((myRank == 0) ? fields * capacity : 0, 0);
+        snapshot.assign(fields * capacity, 0);
+        MPI_Win_create(memory.data(), memory.size() * sizeof(int), sizeof(int), MPI_INFO_NULL, MPI_COMM_WORLD, &window);
+        MPI_Win_lock_all(MPI_MODE_NOCHECK, window);
+    }
+
+    /**
+     * Rank 0 clears the counters through the window, and nobody touches them
+     * before the barrier.
+     */
+    if (myRank == 0)
+    {
+        std::vector<int> zeros(fields * numSizes, 0);
+        MPI_Accumulate(zeros.data(), zeros.size(), MPI_INT, 0, 0, zeros.size(), MPI_INT, MPI_REPLACE, window);
+        MPI_Win_flush(0, window);
+    }
+    MPI_Barrier(MPI_COMM_WORLD);
+}
+
+int MpiCluster::update(
+    int size,
+    field which,
+    int value,
+    MPI_Op op)
+{
+    std::lock_guard<std::mutex> guard(lock);
+    int previous = 0;
+    MPI_Fetch_and_op(&value, &previous, MPI_INT, 0, fields * size + which, op, window);
+    MPI_Win_flush(0, window);
+    return previous;
+}
+
+bool MpiCluster::nextBlock(
+    int size,
+    int blockSize,
+    int end,
+    int &first,
+    int &last)
+{
+    first = update(size, cursorField, blockSize, MPI_SUM);
+
+    if (first >= end)
+    {
+        return false;
+    }
+    last = std::min(first + blockSize, end);
+    return true;
+}
+
+void MpiCluster::setFound(
+    int size)
+{
+    update(size, foundField, 1, MPI_REPLACE);
+}
+
+void MpiCluster::setDone(
+    int size)
+{
+    update(size, doneField, 1, MPI_SUM);
+}
+
+void MpiCluster::poll(
+    std::vector<int> &found,
+    std::vector<int> &done)
+{
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        int count = fields * numSizes;
+        MPI_Get_accumulate(nullptr, 0, MPI_INT, snapshot.data(), count, MPI_INT, 0, 0, count, MPI_INT, MPI_NO_OP, window);
+        MPI_Win_flush(0, window);
+    }
+    found.resize(numSizes);
+    done.resize(numSizes);
+
+    for (int i = 0; i < numSizes; i++)
+    {
+        found[i] = snapshot[fields * i + foundField];
+        done[i] = snapshot[fields * i + doneField];
+    }
+}
+
+void MpiCluster::endIteration()
+{
+    std::lock_guard<std::mutex> guard(lock);
+    MPI_Barrier(MPI_COMM_WORLD);
+}
@@ -0,0 +1,118 @@
+/**@file MpiCluster.h
+ *
+ * @brief Processes of an MPI job that share the clique search of a graph
+ * (@see Cluster). Only compiled with make MPI=1.
+ *
+ * @details The counters and flags of an iteration are three ints per clique
+ * size (next position of the sorted list, found flag and processes done) in a
+ * window exposed by rank 0, which the processes read and update with one-sided
+ * atomic operations, so rank 0 does not need to answer them. MPI is
+ * initialized with MPI_THREAD_SERIALIZED, and every call is made while holding
+ * the lock of the object.
+ *
+ * @author Jose L. Walteros
+ *
+ * @version   1.0
+ * @date      June 2018
+ *
+ * Copyright (C) 2018 Jose L. Walteros. All rights reserved.
+ *
+ *---+----+----+----+----+----+----+----+----+----+----+----+----+----+----+----*/
+#ifndef _MPICLUSTER_H_
+#define _MPICLUSTER_H_
+
+#include <mpi.h>
+#include <mutex>
+#include <vector>
+#include "Cluster.h"
+
+class MpiCluster : public Cluster
+{
+public:
+    /**
+     * MpiCluster constructor: initializes MPI.
+     *
+     * @param[out] success : false if MPI does not support the threads of the
+     * search (MPI is finalized by the destructor anyway).
+     */
+    MpiCluster(
+        bool &success);
+
+    /**
+     * MpiCluster destructor: finalizes MPI.
+     */
+    ~MpiCluster();
+
+    int rank() const;
+
+    int size() const;
+
+    int minimum(
+        int value);
+
+    long long sum(
+        long long value);
+
+    int largest(
+        int value,
+        std::vector<int> &items);
+
+    void broadcast(
+        std::vector<int> &values);
+
+    void beginIteration(
+        int numSizes);
+
+    bool nextBlock(
+        int size,
+        int blockSize,
+        int end,
+        int &first,
+        int &last);
+
+    void setFound(
+        int size);
+
+    void setDone(
+        int size);
+
+    void poll(
+        std::vector<int> &found,
+        std::vector<int> &done);
+
+    void endIteration();
+
+private:
+    static const int fields = 3; /**< Ints per clique size in the window */
+
+    /**
+     * Offsets of the ints of a clique size in the window.
+     */
+    enum field
+    {
+        cursorField, /**< Next position of the sorted list */
+        foundField, /**< Whether a clique of the size was found */
+        doneField /**< Processes that ran out of work */
+    };
+
+    /**
+     * Atomically applies op with value to an int of the window (on rank 0).
+     *
+     * @returns the previous value.
+     */
+    int update(
+        int size,
+        field which,
+        int value,
+        MPI_Op op);
+
+    int numRanks = 1; /**< Number of processes */
+    int myRank = 0; /**< Rank of the process */
+    std::mutex lock; /**< Serializes the MPI calls */
+    int numSizes = 0; /**< Clique sizes of the current iteration */
+    int capacity = 0; /**< Clique sizes that fit in the window */
+    std::vector<int> memory; /**< Memory of the window (only used by rank 0) */
+    MPI_Win window = MPI_WIN_NULL; /**< Counters and flags of the iteration */
+    std::vector<int> snapshot; /**< Buffer of MpiCluster::poll */
+};
+#endif // _MPICLUSTER_H_
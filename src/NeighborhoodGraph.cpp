@@ -0,0 +1,176 @@
+/**@file NeighborhoodGraph.cpp
+ *
+ * @brief Graph induced by the right neighbors of a vertex, with its core
+ * numbers and a greedy coloring.
+ *
+ * @author Jose L. Walteros
+ *
+ * @version   1.0
+ * @date      June 2018
+ *
+ * Copyright (C) 2018 Jose L. Walteros. All rights reserved.
+ *
+ *---+----+----+----+----+----+----+----+----+----+----+----+----+----+----+----*/
+#include <algorithm>
+#include <vector>
+#include "NeighborhoodGraph.h"
+
+void NeighborhoodGraph::build(
+    int v)
+{
+    if (local.empty())
+    {
+        local.assign(graph->n, -1);
+    }
+
+    /**
+     * The local indices of the previous vertex are reset.
+     */
+    for (int u : vertices)
+    {
+        local[u] = -1;
+    }
+
+    n = graph->rightDegree[v];
+    int begin = graph->EdgesBegin[v];
+    vertices.assign(graph->EdgeTo.begin() + begin, graph->EdgeTo.begin() + begin + n);
+
+    if ((int)adjLists.size() < n)
+    {
+        adjLists.resize(n);
+    }
+
+    for (int i = 0; i < n; i++)
+    {
+        local[vertices[i]] = i;
+        adjLists[i].clear();
+    }
+
+    /**
+     * Every edge of G[N+(v)] is found once, among the right neighbors of the
+     * endpoint that comes first in the ordering.
+     */
+    for (int i = 0; i < n; i++)
+    {
+        int u = vertices[i];
+
+        for (int j = graph->EdgesBegin[u]; j < graph->EdgesBegin[u] + graph->rightDegree[u]; j++)
+        {
+            int w = local[graph->EdgeTo[j]];
+
+            if (w >= 0)
+            {
+                adjLists[i].push_back(w);
+                adjLists[w].push_back(i);
+            }
+        }
+    }
+}
+
+int NeighborhoodGraph::coreNumbers()
+{
+    int maxDegree = 0;
+    core.resize(n);
+    order.resize(n);
+    pos.resize(n);
+
+    for (int i = 0; i < n; i++)
+    {
+        core[i] = adjLists[i].size();
+        maxDegree = std::max(maxDegree, core[i]);
+    }
+
+    /**
+     * Bucket sort of the vertices by degree. bins[k] is the position of the
+     * first vertex of degree k in order.
+     */
+    bins.assign(maxDegree + 1, 0);
+
+    for (int i = 0; i < n; i++)
+    {
+        bins[core[i]]++;
+    }
+
+    int start = 0;
+
+    for (int k = 0; k <= maxDegree; k++)
+    {
+        int num = bins[k];
+        bins[k] = start;
+        start += num;
+    }
+
+    for (int i = 0; i < n; i++)
+    {
+        pos[i] = bins[core[i]]++;
+        order[pos[i]] = i;
+    }
+
+    for (int k = maxDegree; k > 0; k--)
+    {
+        bins[k] = bins[k - 1];
+    }
+    bins[0] = 0;
+
+    /**
+     * The vertex of smallest degree is removed, and its neighbors of larger
+     * degree move to the front of the previous bucket.
+     */
+    int maxCore = -1;
+
+    for (int i = 0; i < n; i++)
+    {
+        int u = order[i];
+        maxCore = std::max(maxCore, core[u]);
+
+        for (int w : adjLists[u])
+        {
+            if (core[w] > core[u])
+            {
+                int first = bins[core[w]];
+                int x = order[first];
+
+                if (x != w)
+                {
+                    order[pos[w]] = x;
+                    pos[x] = pos[w];
+                    order[first] = w;
+                    pos[w] = first;
+                }
+                bins[core[w]]++;
+                core[w]--;
+            }
+        }
+    }
+    return maxCore;
+}
+
+int NeighborhoodGraph::greedyColoring()
+{
+    int numColors = 0;
+    color.assign(n, -1);
+    used.assign(n + 1, -1);
+
+    for (int i = n - 1; i >= 0; i--)
+    {
+        int u = order[i];
+
+        for (int w : adjLists[u])
+        {
+            if (color[w] >= 0)
+            {
+                used[color[w]] = u;
+            }
+        }
+
+        int c = 0;
+
+        while (used[c] == u)
+        {
+            c++;
+        }
+        color[u] = c;
+        numColors = std::max(numColors, c + 1);
+    }
+    return numColors;
+}
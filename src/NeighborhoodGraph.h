@@ -0,0 +1,81 @@
+/**@file NeighborhoodGraph.h
+ *
+ * @brief Graph induced by the right neighbors of a vertex, with its core
+ * numbers and a greedy coloring.
+ *
+ * @details A clique of G whose first vertex in the degeneracy ordering is v is
+ * v plus a clique of G[N+(v)], the graph induced by the right neighbors of v.
+ * This class builds G[N+(v)] directly from the CSR arrays of the graph (every
+ * edge is found among the right neighbors of its endpoint that comes first in
+ * the ordering), so it costs a fraction of the complement subgraph of
+ * @see Graph::generateCompGraphRightNeighbors. The vertices are numbered by
+ * their position among the right neighbors of v (the local index).
+ *
+ * The core numbers are computed by peeling (Batagelj and Zaversnik (2003)) and
+ * the coloring takes the vertices in the reverse peeling order (smallest last),
+ * so it uses at most the largest core number + 1 colors. Both numbers bound the
+ * size of the cliques of G[N+(v)].
+ *
+ * The object keeps its scratch data between vertices, so every worker should
+ * own one.
+ *
+ * @author Jose L. Walteros
+ *
+ * @version   1.0
+ * @date      June 2018
+ *
+ * Copyright (C) 2018 Jose L. Walteros. All rights reserved.
+ *
+ *---+----+----+----+----+----+----+----+----+----+----+----+----+----+----+----*/
+#ifndef _NEIGHBORHOODGRAPH_H_
+#define _NEIGHBORHOODGRAPH_H_
+
+#include <vector>
+#include "Graph.h"
+
+class NeighborhoodGraph
+{
+public:
+    Graph *graph; /**< Graph (with its right neighbors first) */
+    int n; /**< Number of vertices (the right degree of the vertex) */
+    std::vector<int> local; /**< Local index of the vertices of the graph (or -1) */
+    std::vector<int> vertices; /**< Right neighbors of the vertex */
+    std::vector<std::vector<int> > adjLists; /**< Local adjacency lists */
+    std::vector<int> core; /**< Core number of the local vertices */
+    std::vector<int> order; /**< Local vertices in the order they were peeled */
+    std::vector<int> pos; /**< Position of the local vertices in order */
+    std::vector<int> bins; /**< Buckets of the peeling */
+    std::vector<int> color; /**< Color of the local vertices */
+    std::vector<int> used; /**< Last local vertex that saw each color */
+
+    /**
+     * NeighborhoodGraph constructor.
+     *
+     * @param[in] graph : The graph. Its ordering must have been computed and
+     * its right neighbors moved to the front (@see Graph::rightNeighborsFirst).
+     */
+    inline NeighborhoodGraph(
+        Graph &graph) : graph(&graph), n(0) {}
+
+    /**
+     * Builds G[N+(v)].
+     */
+    void build(
+        int v);
+
+    /**
+     * Computes the core numbers of the local vertices and the peeling order.
+     *
+     * @returns the largest core number (-1 if the graph is empty).
+     */
+    int coreNumbers();
+
+    /**
+     * Colors the local vertices greedily in the reverse peeling order
+     * (NeighborhoodGraph::coreNumbers must have been called).
+     *
+     * @returns the number of colors.
+     */
+    int greedyColoring();
+};
+#endif // _NEIGHBORHOODGRAPH_H_
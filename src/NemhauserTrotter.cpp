@@ -0,0 +1,557 @@
+/**@file NemhauserTrotter.cpp
+ *
+ * @brief Finds the linear relaxation of the vertex cover formulation and removes
+ * the vertices for which the corresponding variable is either 1 or 0.
+ *
+ * @details The procedure generates a bipartite graph G' in which the two
+ * partitions correspond to copies of the original vertices. Then, it uses Hopcroft-Karp to find a
+ * maximum matching and then Tarjan's SCC algorithm to extract a vertex cover with the least
+ * number of fractional variables in such a G'.
+ *
+ * @author Jose L. Walteros
+ *
+ * @version   1.0
+ * @date      January 2018
+ *
+ * Copyright (C) 2018 Jose L. Walteros. All rights reserved.
+ *
+ *---+----+----+----+----+----+----+----+----+----+----+----+----+----+----+----*/
+#include <algorithm>
+#include <limits.h>
+#include "Graph.h"
+#include "NemhauserTrotter.h"
+
+int NemhauserTrotter::getKernel(
+    subgraph &kernel,
+    int &numRemoved,
+    int &numInVC)
+{
+    HopcroftKarp();
+
+    if (cancelled())
+    {
+        return -1;
+    }
+    Tarjan();
+
+    if (cancelled())
+    {
+        return -1;
+    }
+
+    /**
+     * The following code generates the SCC graph. That is, a vertex is assigned
+     * to
+     * each component and an arc from component k1 to component k2 is created
+     * if there is an arc whose tail and head are in k1 and k2, respectively.
+     */
+    int n = sG->n;
+    ws.arcTail.clear();
+    ws.arcHead.clear();
+    ws.compOutDegree.assign(numComponents, 0);
+    ws.connected.assign(numComponents, -1);
+
+    for (int t = 0; t < numComponents; t++)
+    {
+        for (int i = ws.compBegin[t]; i < ws.compBegin[t + 1]; i++)
+        {
+            int v = ws.compVertices[i];
+
+            if (v < n)
+            {
+                for (std::vector<int>::iterator u = sG->adjLists[v].begin(); u != sG->adjLists[v].end(); u++)
+                {
+                    int tail = ws.componentMap[*u + n];
+
+                    if ((ws.componentMap[v] != tail) && (ws.connected[tail] != t))
+                    {
+                        ws.arcTail.push_back(tail);
+                        ws.arcHead.push_back(t);
+                        ws.compOutDegree[t]++;
+                        ws.connected[tail] = t;
+                    }
+                }
+            }
+            else
+            {
+                if (ws.matchR[v - n] >= 0)
+                {
+                    int tail = ws.componentMap[ws.matchR[v - n]];
+
+                    if ((ws.componentMap[v] != tail) && (ws.connected[tail] != t))
+                    {
+                        ws.arcTail.push_back(tail);
+                        ws.arcHead.push_back(t);
+                        ws.compOutDegree[t]++;
+                        ws.connected[tail] = t;
+                    }
+                }
+            }
+        }
+    }
+
+    /**
+     * The arcs are grouped by their tail (counting sort).
+     */
+    int numArcs = ws.arcTail.size();
+    ws.arcBegin.assign(numComponents + 1, 0);
+    ws.arcs.resize(numArcs);
+
+    for (int a = 0; a < numArcs; a++)
+    {
+        ws.arcBegin[ws.arcTail[a] + 1]++;
+    }
+
+    for (int p = 0; p < numComponents; p++)
+    {
+        ws.arcBegin[p + 1] += ws.arcBegin[p];
+    }
+
+    for (int a = 0; a < numArcs; a++)
+    {
+        ws.arcs[ws.arcBegin[ws.arcTail[a]]++] = ws.arcHead[a];
+    }
+
+    for (int p = numComponents; p > 0; p--)
+    {
+        ws.arcBegin[p] = ws.arcBegin[p - 1];
+    }
+    ws.arcBegin[0] = 0;
+
+    /**
+     * The vertices of G' in the closed set Z (no arc leaves it) give the
+     * minimum vertex cover C = (L \ Z) + (R & Z) of G', so x_v is 0 if only the
+     * left copy of v is in Z, 1 if only its right copy is, and 1/2 otherwise.
+     * Z is optimal when it has every free left vertex and no free right vertex.
+     * The vertices reachable from the free left vertices are therefore taken
+     * first, and then the components whose successors have all been taken and
+     * that do not put both copies of a vertex in Z. Tarjan's algorithm numbers
+     * the components in reverse topological order, so a single pass decides
+     * them.
+     */
+    std::vector<char> &taken = ws.taken;
+    taken.assign(2 * n, false);
+    ws.queue.clear();
+
+    for (int v = 0; v < n; v++)
+    {
+        if (ws.matchL[v] == -1)
+        {
+            taken[v] = true;
+            ws.queue.push_back(v);
+        }
+    }
+
+    for (size_t head = 0; head < ws.queue.size(); head++)
+    {
+        int w = ws.queue[head];
+
+        if (w < n)
+        {
+            for (int u : sG->adjLists[w])
+            {
+                if (!taken[u + n])
+                {
+                    taken[u + n] = true;
+                    ws.queue.push_back(u + n);
+                }
+            }
+        }
+        else if (!taken[ws.matchR[w - n]])
+        {
+            taken[ws.matchR[w - n]] = true;
+            ws.queue.push_back(ws.matchR[w - n]);
+        }
+    }
+
+    for (int p = 0; p < numComponents; p++)
+    {
+        if (cancelled())
+        {
+            return -1;
+        }
+        int first = ws.compVertices[ws.compBegin[p]];
+        bool take = taken[first];
+
+        if (!take && (ws.compOutDegree[p] == 0) && ws.toBeRemoved[p] && ((first < n) || (ws.matchR[first - n] >= 0)))
+        {
+            take = true;
+
+            for (int i = ws.compBegin[p]; (i < ws.compBegin[p + 1]) && take; i++)
+            {
+                int v = ws.compVertices[i];
+                take = !taken[(v < n) ? v + n : v - n];
+            }
+        }
+
+        if (take)
+        {
+            for (int i = ws.compBegin[p]; i < ws.compBegin[p + 1]; i++)
+            {
+                taken[ws.compVertices[i]] = true;
+            }
+
+            for (int a = ws.arcBegin[p]; a < ws.arcBegin[p + 1]; a++)
+            {
+                ws.compOutDegree[ws.arcs[a]]--;
+            }
+        }
+    }
+    std::vector<bool> &removed = ws.removed;
+    removed.assign(n, false);
+
+    for (int v = 0; v < n; v++)
+    {
+        if (taken[v] != taken[v + n])
+        {
+            removed[v] = true;
+            numRemoved++;
+
+            if (taken[v + n])
+            {
+                numInVC++;
+                inCover.push_back(sG->vertices[v].v);
+            }
+        }
+    }
+
+    /**
+     * If there are more vertices in the vertex cover than @param k, return -1.
+     */
+    if (numInVC > k)
+    {
+        return -1;
+    }
+
+    /**
+     * If no vertex is removed, return 0. Also, the kernel is equal to the
+     * original subgraph
+     * the original subgraph is then hard-copied into the kernel.
+     */
+    if (numRemoved == 0)
+    {
+        kernel = *sG;
+        return 0;
+    }
+
+    /**
+     * If the number of vertices in the kernel is less than @param k -
+     * highDegVertices,
+     * returns 1 (there is a VC).
+     */
+    if (sG->n - numRemoved <= k - numInVC)
+    {
+        for (int i = 0; i < n; i++)
+        {
+            if (removed[i] == false)
+            {
+                inCover.push_back(sG->vertices[i].v);
+            }
+        }
+        return 1;
+    }
+
+    /**
+     * The kernel is generated based on the vector of removed vertices.
+     */
+    VertexCover VC;
+    VC.subgraphUpdate(sG->n, numRemoved, sG->vertices, sG->adjLists, removed, kernel);
+
+    /**
+     * If the number of edges in the kernel is less than k*(k-highDegVertices),
+     * returns -1 (there is no VC).
+     */
+    if (kernel.m > k * (k - numInVC))
+    {
+        return -1;
+    }
+
+    /**
+     * Return 0, as there could be a VC.
+     */
+    return 0;
+}
+
+void NemhauserTrotter::warmStart(
+    const std::vector<int> &mate,
+    const std::vector<int> &origin)
+{
+    ws.where.assign(mate.size(), -1);
+
+    for (int i = 0; i < sG->n; i++)
+    {
+        ws.where[origin[i]] = i;
+    }
+
+    for (int i = 0; i < sG->n; i++)
+    {
+        int j = mate[origin[i]];
+
+        if ((j >= 0) && (ws.where[j] >= 0) && (ws.matchR[ws.where[j]] == -1))
+        {
+            ws.matchL[i] = ws.where[j];
+            ws.matchR[ws.where[j]] = i;
+        }
+    }
+}
+
+void NemhauserTrotter::saveMatching(
+    std::vector<int> &mate,
+    const std::vector<int> &origin)
+{
+    for (int i = 0; i < sG->n; i++)
+    {
+        mate[origin[i]] = (ws.matchL[i] >= 0) ? origin[ws.matchL[i]] : -1;
+    }
+}
+
+void NemhauserTrotter::HopcroftKarp()
+{
+    int dMax;
+    int n = sG->n;
+    ws.dist.assign(n, 0);
+
+    while (!cancelled() && BFS(dMax))
+    {
+        for (int u = 0; u < n; u++)
+        {
+            if (ws.matchL[u] == -1)
+            {
+                DFS(u, dMax);
+            }
+        }
+    }
+}
+
+bool NemhauserTrotter::BFS(
+    int &dMax)
+{
+    int n = sG->n;
+    ws.queue.clear();
+
+    for (int u = 0; u < n; u++)
+    {
+        if (ws.matchL[u] == -1)
+        {
+            ws.dist[u] = 0;
+            ws.queue.push_back(u);
+        }
+        else
+        {
+            ws.dist[u] = INT_MAX;
+        }
+    }
+    dMax = INT_MAX;
+
+    for (size_t head = 0; head < ws.queue.size(); head++)
+    {
+        int u = ws.queue[head];
+
+        if (ws.dist[u] < dMax)
+        {
+            for (int v : sG->adjLists[u])
+            {
+                if (ws.matchR[v] == -1)
+                {
+                    if (dMax == INT_MAX)
+                    {
+                        dMax = ws.dist[u] + 1;
+                    }
+                }
+                else
+                {
+                    if (ws.dist[ws.matchR[v]] == INT_MAX)
+                    {
+                        ws.dist[ws.matchR[v]] = ws.dist[u] + 1;
+                        ws.queue.push_back(ws.matchR[v]);
+                    }
+                }
+            }
+        }
+    }
+    return dMax != INT_MAX;
+}
+
+bool NemhauserTrotter::DFS(
+    int u,
+    int dMax)
+{
+    /**
+     * ws.path holds the left vertices of the current path and ws.next the
+     * position of the next edge of each of them. The path only goes to the
+     * next layer, so no vertex appears twice.
+     */
+    ws.path.assign(1, u);
+    ws.next.assign(1, 0);
+
+    while (!ws.path.empty())
+    {
+        int w = ws.path.back();
+        int e = ws.next.back();
+
+        if (e == (int)sG->adjLists[w].size())
+        {
+            ws.dist[w] = INT_MAX;
+            ws.path.pop_back();
+            ws.next.pop_back();
+            continue;
+        }
+        ws.next.back()++;
+        int v = sG->adjLists[w][e];
+        int k = ws.matchR[v];
+        int distK = (k >= 0) ? ws.dist[k] : dMax;
+
+        if (distK != ws.dist[w] + 1)
+        {
+            continue;
+        }
+
+        if (k >= 0)
+        {
+            ws.path.push_back(k);
+            ws.next.push_back(0);
+            continue;
+        }
+
+        /**
+         * v is free: the path is augmented.
+         */
+        for (int i = ws.path.size() - 1; i >= 0; i--)
+        {
+            int x = ws.path[i];
+            int y = sG->adjLists[x][ws.next[i] - 1];
+            ws.matchR[y] = x;
+            ws.matchL[x] = y;
+        }
+        return true;
+    }
+    return false;
+}
+
+void NemhauserTrotter::Tarjan()
+{
+    int n = sG->n;
+
+    ws.indices.assign(2 * n, -1);
+    ws.lowLink.assign(2 * n, 0);
+    ws.onStack.assign(2 * n, false);
+    ws.componentMap.resize(2 * n);
+    ws.vertexMap.assign(n, -1);
+    ws.compBegin.assign(1, 0);
+    ws.compVertices.clear();
+    ws.toBeRemoved.clear();
+    ws.stack.clear();
+    numComponents = 0;
+    index = 0;
+
+    for (int i = 0; (i < n) && !cancelled(); i++)
+    {
+        if (ws.indices[i] == -1)
+        {
+            strongConnect(i);
+        }
+    }
+}
+
+void NemhauserTrotter::strongConnect(
+    int v)
+{
+    int n = sG->n;
+    ws.calls.clear();
+    ws.next.clear();
+
+    /**
+     * The successors of a left vertex v are the right copies of its
+     * neighbors, and the only successor of a right vertex is its match.
+     */
+    ws.indices[v] = index;
+    ws.lowLink[v] = index;
+    index++;
+    ws.stack.push_back(v);
+    ws.onStack[v] = true;
+    ws.calls.push_back(v);
+    ws.next.push_back(0);
+
+    while (!ws.calls.empty())
+    {
+        int w = ws.calls.back();
+        int e = ws.next.back();
+        int u = -1;
+
+        if (w < n)
+        {
+            if (e < (int)sG->adjLists[w].size())
+            {
+                u = sG->adjLists[w][e] + n;
+            }
+        }
+        else if ((e == 0) && (ws.matchR[w - n] >= 0))
+        {
+            u = ws.matchR[w - n];
+        }
+
+        if (u >= 0)
+        {
+            ws.next.back()++;
+
+            if (ws.indices[u] == -1)
+            {
+                ws.indices[u] = index;
+                ws.lowLink[u] = index;
+                index++;
+                ws.stack.push_back(u);
+                ws.onStack[u] = true;
+                ws.calls.push_back(u);
+                ws.next.push_back(0);
+            }
+            else if (ws.onStack[u])
+            {
+                ws.lowLink[w] = std::min(ws.lowLink[w], ws.lowLink[u]);
+            }
+            continue;
+        }
+
+        /**
+         * All the successors of w have been visited.
+         */
+        if (ws.lowLink[w] == ws.indices[w])
+        {
+            popComponent(w);
+        }
+        ws.calls.pop_back();
+        ws.next.pop_back();
+
+        if (!ws.calls.empty())
+        {
+            int parent = ws.calls.back();
+            ws.lowLink[parent] = std::min(ws.lowLink[parent], ws.lowLink[w]);
+        }
+    }
+}
+
+void NemhauserTrotter::popComponent(
+    int v)
+{
+    int n = sG->n;
+    ws.toBeRemoved.push_back(true);
+    int u;
+
+    do
+    {
+        u = ws.stack.back();
+        ws.stack.pop_back();
+        ws.onStack[u] = false;
+        ws.componentMap[u] = numComponents;
+        ws.compVertices.push_back(u);
+
+        if (ws.vertexMap[u % n] == numComponents)
+        {
+            ws.toBeRemoved[numComponents] = false;
+        }
+        ws.vertexMap[u % n] = numComponents;
+    }
+    while (u != v);
+
+    ws.compBegin.push_back(ws.compVertices.size());
+    numComponents++;
+}
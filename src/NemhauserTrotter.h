@@ -0,0 +1,232 @@
+/**@file NemhauserTrotter.h
+ *
+ * @brief Finds the linear relaxation of the vertex cover formulation and removes
+ * the vertices for which the corresponding variable is either 1 or
+ * 0.
+ *
+ * @details The procedure generates a bipartite graph G' in which the two
+ * partitions correspond to copies of the original vertices. Then, it uses Hopcroft-Karp to find a
+ * maximum matching and then Tarjan's SCC algorithm to extract a vertex cover with the least
+ * number of fractional variables in such a G'.
+ *
+ * If the cancellation token is set while the kernel is generated, the procedure
+ * stops and returns -1.
+ *
+ * Both Hopcroft-Karp and Tarjan's algorithm are iterative (they keep their own
+ * stacks), so the depth of the bipartite graph does not reach the call stack,
+ * and their data is kept in flat arrays of an ntWorkspace. A worker that owns a
+ * workspace and passes it to every kernel it generates reuses the arrays, which
+ * only grow, instead of allocating them for every subgraph.
+ *
+ * @author Jose L. Walteros
+ *
+ * @version   1.0
+ * @date      January 2018
+ *
+ * Copyright (C) 2018 Jose L. Walteros. All rights reserved.
+ *
+ *---+----+----+----+----+----+----+----+----+----+----+----+----+----+----+----*/
+#ifndef _NEMHAUSERTROTTER_H_
+#define _NEMHAUSERTROTTER_H_
+
+#include <vector>
+#include <algorithm>
+#include <atomic>
+#include "Graph.h"
+#include "VertexCover.h"
+
+/**
+ * Arrays used by NemhauserTrotter. The left copy of vertex v of the subgraph is
+ * the vertex v of the bipartite graph and its right copy is v + n.
+ */
+struct ntWorkspace
+{
+    /**
+     * Data for the bipartite matching algorithm (Hopcroft-Karp)
+     */
+    std::vector<int> matchL; /**< Match of the vertices in the left set. */
+    std::vector<int> matchR; /**< Match of the vertices in the right set. */
+    std::vector<int> dist; /**< Layer of the left vertices in the BFS. */
+    std::vector<int> queue; /**< Queue of the BFS. */
+    std::vector<int> path; /**< Left vertices of the augmenting path of the DFS. */
+    std::vector<int> where; /**< Position of the vertices of a previous
+    * subgraph (@see NemhauserTrotter::warmStart). */
+
+    /**
+     * Data for the strongly connected components algorithm (Tarjan).
+     */
+    std::vector<int> indices; /**< Discovery time of v. */
+    std::vector<int> lowLink; /**< the smallest index of any vertex known to be
+    * reachable from v, including v itself. */
+    std::vector<char> onStack; /**< Is v still in the stack? */
+    std::vector<int> stack; /**< Stack of vertices. */
+    std::vector<int> calls; /**< Vertices whose search is in progress. */
+    std::vector<int> next; /**< Next successor of the vertices in calls (and
+    * next edge of the vertices of path). */
+
+    /**
+     * Strongly connected component data
+     */
+    std::vector<int> componentMap; /**< SSC that contains v. */
+    std::vector<int> compBegin; /**< Position of the first vertex of every SCC
+    * in compVertices (one more entry marks the end). */
+    std::vector<int> compVertices; /**< Vertices of the SCCs, one after the other. */
+    std::vector<int> vertexMap; /**< Map used to check if both the left and right
+    * copies of v are covered by the same SCC. */
+    std::vector<char> toBeRemoved; /**< If the S can be removed(V(S_L) \cap v(S_R)
+    * = \emptyset). */
+
+    /*
+     * Data required for producing the kernel
+     */
+    std::vector<int> arcTail; /**< Tail of the arcs between SCCs. */
+    std::vector<int> arcHead; /**< Head of the arcs between SCCs. */
+    std::vector<int> arcBegin; /**< Position of the first arc leaving every SCC
+    * in arcs (one more entry marks the end). */
+    std::vector<int> arcs; /**< Heads of the arcs, grouped by their tail. */
+    std::vector<int> compOutDegree; /**< outdegree of component p. */
+    std::vector<int> connected; /**< This map is used to check if and arc between
+    * two components already exists. */
+    std::vector<char> taken; /**< If the vertex of G' is in the closed set. */
+    std::vector<bool> removed; /**< If vertex v has been removed. */
+};
+
+class NemhauserTrotter
+{
+public:
+    subgraph *sG; /**< Subgraph to be processed.*/
+    int k; /**< Expected size of the VC.*/
+    const std::atomic<bool> *cancel; /**< Cancellation token (may be null).*/
+    std::vector<int> inCover; /**< Names of the vertices that are in the VC (the
+    * ones whose variable is 1, and the whole kernel if the procedure returns 1).*/
+    ntWorkspace own; /**< Workspace used when none is given. */
+    ntWorkspace &ws; /**< Workspace of the procedure. */
+    int index; /**< Discover time counter (Tarjan). */
+    int numComponents; /**< Number of SCC. */
+
+    /**
+     * NemhauserTrotter constructor: Receives the graph to be processed and the
+     * expected VC size.
+     * @param[in] sG : Subgraph to be processed.
+     * @param[in] k : Expected size of the VC.
+     * @param[in] cancel : If not null, the procedure stops once it is set.
+     * @param[in] workspace : If not null, the arrays of the procedure (which
+     * must not be shared with another thread).
+     */
+    inline NemhauserTrotter(
+        subgraph *sG,
+        int k,
+        const std::atomic<bool> *cancel = nullptr,
+        ntWorkspace *workspace = nullptr) : ws((workspace != nullptr) ? *workspace : own)
+    {
+        this->sG = sG;
+        this->k = k;
+        this->cancel = cancel;
+        this->index = 0;
+        this->numComponents = 0;
+        ws.matchL.assign(sG->n, -1);
+        ws.matchR.assign(sG->n, -1);
+    }
+
+    NemhauserTrotter(const NemhauserTrotter &) = delete;
+    NemhauserTrotter &operator=(const NemhauserTrotter &) = delete;
+
+    /**
+     * Whether the cancellation token has been set.
+     */
+    inline bool cancelled() const
+    {
+        return (cancel != nullptr) && cancel->load(std::memory_order_relaxed);
+    }
+
+    /**
+     * This procedure generates the Nemhauser*Trotter kernel.
+     * @param[out] kernel : NT kernel.
+     * @param[out] numRemoved : Number of vertices removed from the graph
+     * @param[out] numInVC : Number of vertices added to the VC.
+     *
+     * @returns -1 if there is no VC in the subgraph, 1 if there is a VC in the
+     * subgraph,and 0 if there could be a VC in the subgraph.
+     */
+    int getKernel(
+        subgraph &kernel,
+        int &numRemoved,
+        int &numInVC);
+
+    /**
+     * Starts the matching from the one of a previous kernel (on a different k)
+     * of the same subgraph sG0. The graph sG must be an induced subgraph of
+     * sG0, so the edges of the previous matching whose ends are both in sG are
+     * still edges of the bipartite graph.
+     *
+     * @param[in] mate : Previous matching. The left copy of the vertex i of sG0
+     * was matched with the right copy of mate[i] (-1 if it was not matched).
+     * @param[in] origin : Index in sG0 of every vertex of sG.
+     */
+    void warmStart(
+        const std::vector<int> &mate,
+        const std::vector<int> &origin);
+
+    /**
+     * Writes the matching of the vertices of sG in mate (@see
+     * NemhauserTrotter::warmStart), keeping the entries of the other vertices
+     * of sG0.
+     */
+    void saveMatching(
+        std::vector<int> &mate,
+        const std::vector<int> &origin);
+
+    /**
+     * Hopcroft-Karp procedure: Finds a maximum matching of bipartite graphs. It
+     * is an augmenting path algorithm that shares similarities with max-flow
+     * algorithms, but has a better asymptotic complexity
+     *
+     * The procedure uses functions BFS and DFS (@see NemhauserTrotter::BFS and
+     * NemhauserTrotter::DFS)
+     */
+    void HopcroftKarp();
+
+    /**
+     * Computes the layers of the left vertices, starting from the unmatched
+     * ones.
+     *
+     * @param[out] dMax : Length of the shortest augmenting paths.
+     *
+     * @returns whether there is an augmenting path.
+     */
+    bool BFS(
+        int &dMax);
+
+    /**
+     * Looks for an augmenting path from the unmatched left vertex u along the
+     * layers of the BFS and, if there is one, augments the matching. The left
+     * vertices that lead to no augmenting path leave the layers.
+     */
+    bool DFS(
+        int u,
+        int dMax);
+
+    /**
+     * Tarjan procedure: Finds the strongly connected components of the residual
+     * graph given by the matching. This version of Tarjan's is tailored for the graph
+     * resulting from the matching.
+     *
+     * The procedure uses the function strongConnect (@see
+     * NemhauserTrotter::strongConnect).
+     */
+    void Tarjan();
+
+    /**
+     * Depth first search of Tarjan's algorithm from v, which keeps the
+     * vertices whose search is in progress in ws.calls instead of recursing.
+     */
+    void strongConnect(
+        int v);
+
+    /**
+     * Closes the SCC whose root is v: pops its vertices from the stack.
+     */
+    void popComponent(
+        int v);
+};
+#endif // _NEMHAUSERTROTTER_H_
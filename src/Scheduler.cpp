@@ -0,0 +1,204 @@
+/**@file Scheduler.cpp
+ *
+ * @brief Dynamic scheduler for the subgraphs processed while testing a clique
+ * size.
+ *
+ * @details The vertices of the sorted list are handed out in chunks through an
+ * atomic cursor. Every worker owns a deque of vertex cover subproblems; the
+ * owner works on the back of its deque and idle workers steal from the front
+ * of the others.
+ *
+ * A worker is counted as active while it holds work (a chunk of vertices or a
+ * task). Only the owner pushes to a deque and it only becomes idle once its
+ * deque is empty, so when no worker is active there is no work left.
+ *
+ * @author Jose L. Walteros
+ *
+ * @version   1.0
+ * @date      June 2018
+ *
+ * Copyright (C) 2018 Jose L. Walteros. All rights reserved.
+ *
+ *---+----+----+----+----+----+----+----+----+----+----+----+----+----+----+----*/
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+#include <thread>
+#include "Scheduler.h"
+
+Scheduler::Scheduler(
+    int numThreads,
+    int numVertices,
+    int chunkSize,
+    const std::atomic<bool> &stop) : numThreads(numThreads), chunkSize(std::max(chunkSize, 1)),
+    stop(stop), cursor(0), limit(numVertices), numActive(numThreads), numIdle(0), numTasks(0),
+    queues(numThreads)
+{
+}
+
+void *Scheduler::operator new(
+    size_t size)
+{
+    /**
+     * The pointer returned by malloc is stored right before the aligned
+     * block.
+     */
+    const size_t alignment = alignof(Scheduler);
+    void *block = malloc(size + alignment + sizeof(void *));
+
+    if (block == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+    uintptr_t address = ((uintptr_t)block + sizeof(void *) + alignment - 1) & ~(uintptr_t)(alignment - 1);
+    ((void **)address)[-1] = block;
+    return (void *)address;
+}
+
+void Scheduler::operator delete(
+    void *p)
+{
+    if (p != nullptr)
+    {
+        free(((void **)p)[-1]);
+    }
+}
+
+bool Scheduler::nextVertices(
+    int &first,
+    int &last)
+{
+    int end = limit.load(std::memory_order_relaxed);
+
+    if (refill)
+    {
+        /**
+         * The chunks are taken from the block of the process, which is
+         * replaced by the next one when it runs out.
+         */
+        std::lock_guard<std::mutex> guard(blockLock);
+
+        if (blockNext >= blockEnd)
+        {
+            blocksLeft = blocksLeft && refill(blockNext, blockEnd);
+
+            if (!blocksLeft)
+            {
+                return false;
+            }
+        }
+        first = blockNext;
+
+        if (first >= end)
+        {
+            return false;
+        }
+        last = std::min({first + chunkSize, blockEnd, end});
+        blockNext = last;
+        return true;
+    }
+
+    if (cursor.load(std::memory_order_relaxed) >= end)
+    {
+        return false;
+    }
+
+    first = cursor.fetch_add(chunkSize, std::memory_order_relaxed);
+
+    if (first >= end)
+    {
+        return false;
+    }
+    last = std::min(first + chunkSize, end);
+    return true;
+}
+
+void Scheduler::stopAt(
+    int index)
+{
+    int current = limit.load(std::memory_order_relaxed);
+
+    while ((index < current) && !limit.compare_exchange_weak(current, index, std::memory_order_relaxed))
+    {
+    }
+}
+
+void Scheduler::push(
+    int worker,
+    vcTask &&task)
+{
+    std::lock_guard<std::mutex> guard(queues[worker].lock);
+    queues[worker].tasks.push_back(std::move(task));
+    numTasks.fetch_add(1);
+}
+
+bool Scheduler::pop(
+    int worker,
+    vcTask &task)
+{
+    std::lock_guard<std::mutex> guard(queues[worker].lock);
+
+    if (queues[worker].tasks.empty())
+    {
+        return false;
+    }
+    task = std::move(queues[worker].tasks.back());
+    queues[worker].tasks.pop_back();
+    numTasks.fetch_sub(1);
+    return true;
+}
+
+bool Scheduler::steal(
+    int worker,
+    vcTask &task)
+{
+    for (int i = 1; i < numThreads; i++)
+    {
+        taskQueue &victim = queues[(worker + i) % numThreads];
+        std::lock_guard<std::mutex> guard(victim.lock);
+
+        if (!victim.tasks.empty())
+        {
+            task = std::move(victim.tasks.front());
+            victim.tasks.pop_front();
+            numTasks.fetch_sub(1);
+            return true;
+        }
+    }
+    return false;
+}
+
+bool Scheduler::waitForTask(
+    int worker,
+    vcTask &task)
+{
+    numIdle.fetch_add(1);
+    numActive.fetch_sub(1);
+
+    while (!stop)
+    {
+        if (numTasks.load() > 0)
+        {
+            /**
+             * The worker is counted as active before taking the task, so the
+             * others cannot see the work as finished in between.
+             */
+            numActive.fetch_add(1);
+
+            if (steal(worker, task))
+            {
+                numIdle.fetch_sub(1);
+                return true;
+            }
+            numActive.fetch_sub(1);
+        }
+        else if (numActive.load() == 0)
+        {
+            break;
+        }
+        std::this_thread::yield();
+    }
+    numIdle.fetch_sub(1);
+    return false;
+}
@@ -0,0 +1,173 @@
+/**@file Scheduler.h
+ *
+ * @brief Dynamic scheduler for the subgraphs processed while testing a clique
+ * size.
+ *
+ * @details The vertices of the sorted list are handed out in chunks through an
+ * atomic cursor, so a thread that finishes early simply takes the next chunk
+ * instead of waiting for the others. In addition, every worker owns a deque of
+ * vertex cover subproblems (@see vcTask). When some workers are idle, the
+ * branch-and-reduce recursion (@see VertexCover::kVertexCover) publishes the
+ * second branch of a node in the deque of its worker instead of exploring it
+ * right away. The owner pops its own tasks from the back (depth first), while
+ * idle workers steal from the front of the other deques (larger subtrees).
+ *
+ * The work of a clique size ends when the cursor is exhausted, all the deques
+ * are empty and no worker is busy (or when a clique has been found).
+ *
+ * If the search is shared by several processes (@see Cluster), the cursor
+ * only runs over the blocks of positions that the process takes from the
+ * counter of all of them (@see Scheduler::refill).
+ *
+ * @author Jose L. Walteros
+ *
+ * @version   1.0
+ * @date      June 2018
+ *
+ * Copyright (C) 2018 Jose L. Walteros. All rights reserved.
+ *
+ *---+----+----+----+----+----+----+----+----+----+----+----+----+----+----+----*/
+#ifndef _SCHEDULER_H_
+#define _SCHEDULER_H_
+
+#include <atomic>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <vector>
+#include "Graph.h"
+
+/**
+ * Vertex cover subproblem: does the graph have a vertex cover of size k?
+ */
+struct vcTask
+{
+    int n; /**< Number of vertices in the graph */
+    int k; /**< Expected size of the vertex cover */
+    std::vector<vertex> vertices; /**< Vertices of the graph */
+    std::vector<std::vector<int> > adjLists; /**< Adj. lists of the vertices */
+    int root; /**< Vertex whose subgraph contains the task */
+    std::vector<coverStep> steps; /**< Decisions that led to the task, used to
+    * rebuild the vertex cover of the subgraph (@see VertexCover::steps) */
+};
+
+class Scheduler
+{
+public:
+    static const int minTaskSize = 24; /**< Smallest graph worth publishing */
+    std::function<bool(int &, int &)> refill; /**< If set, gives the next block
+    * [first, last) of the sorted list when the chunks of the current one run
+    * out, and returns false when there are no more blocks. Only one worker
+    * calls it at a time */
+
+    /**
+     * Scheduler constructor.
+     *
+     * @param[in] numThreads : Number of workers.
+     * @param[in] numVertices : Number of vertices in the sorted list.
+     * @param[in] chunkSize : Number of vertices handed out at a time.
+     * @param[in] stop : Flag that ends the work when it is set.
+     */
+    Scheduler(
+        int numThreads,
+        int numVertices,
+        int chunkSize,
+        const std::atomic<bool> &stop);
+
+    /**
+     * Allocates a scheduler aligned to a cache line, since the operator new
+     * of C++14 ignores the alignment of its counters.
+     */
+    static void *operator new(
+        size_t size);
+
+    /**
+     * Frees a scheduler allocated by Scheduler::operator new.
+     */
+    static void operator delete(
+        void *p);
+
+    /**
+     * Takes the next chunk [first, last) of the sorted list.
+     *
+     * @returns false if there are no more vertices.
+     */
+    bool nextVertices(
+        int &first,
+        int &last);
+
+    /**
+     * No vertex at position index or beyond in the sorted list will be handed
+     * out (used when the remaining vertices cannot have a clique).
+     */
+    void stopAt(
+        int index);
+
+    /**
+     * Whether there are idle workers with no task to steal. The recursion
+     * publishes branches only in that case.
+     */
+    inline bool needsTasks() const
+    {
+        return numIdle.load(std::memory_order_relaxed) > numTasks.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * Publishes a task in the deque of the worker.
+     */
+    void push(
+        int worker,
+        vcTask &&task);
+
+    /**
+     * Pops the newest task of the worker's own deque.
+     *
+     * @returns false if the deque is empty.
+     */
+    bool pop(
+        int worker,
+        vcTask &task);
+
+    /**
+     * Called by a worker that has no vertices nor tasks of its own. The worker
+     * waits until it can steal a task from another deque or the work ends.
+     *
+     * @returns false if the work has ended.
+     */
+    bool waitForTask(
+        int worker,
+        vcTask &task);
+
+private:
+    /**
+     * Deque of tasks of a worker.
+     */
+    struct taskQueue
+    {
+        std::mutex lock; /**< Protects the deque */
+        std::deque<vcTask> tasks; /**< Published tasks */
+    };
+
+    /**
+     * Steals the oldest task of one of the other deques.
+     */
+    bool steal(
+        int worker,
+        vcTask &task);
+
+    int numThreads; /**< Number of workers */
+    int chunkSize; /**< Size of the chunks of the sorted list */
+    const std::atomic<bool> &stop; /**< Ends the work when set */
+    std::mutex blockLock; /**< Protects the block (with Scheduler::refill) */
+    int blockNext = 0; /**< Next position of the block */
+    int blockEnd = 0; /**< End of the block */
+    bool blocksLeft = true; /**< Whether Scheduler::refill may give more blocks */
+    alignas(64) std::atomic<int> cursor; /**< Next position of the sorted list */
+    alignas(64) std::atomic<int> limit; /**< End of the useful part of the list */
+    alignas(64) std::atomic<int> numActive; /**< Workers that are busy */
+    alignas(64) std::atomic<int> numIdle; /**< Workers waiting for tasks */
+    alignas(64) std::atomic<int> numTasks; /**< Tasks in all the deques */
+    std::vector<taskQueue> queues; /**< One deque per worker */
+};
+#endif // _SCHEDULER_H_
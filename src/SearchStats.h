@@ -0,0 +1,151 @@
+/**@file SearchStats.h
+ *
+ * @brief Counters and timers of the phases of the search, kept by every
+ * worker (@see Clique::writeStats).
+ *
+ * @details The statistics are only collected when the code is compiled with
+ * DOMEGA_STATS defined (make STATS=1). Otherwise statsEnabled is false and
+ * the compiler removes the code that updates them, so the hot paths pay
+ * nothing for them. Every worker updates its own workerStats without
+ * synchronization, and the workers are added up when they are written.
+ *
+ * @author Jose L. Walteros
+ *
+ * @version   1.0
+ * @date      June 2018
+ *
+ * Copyright (C) 2018 Jose L. Walteros. All rights reserved.
+ *
+ *---+----+----+----+----+----+----+----+----+----+----+----+----+----+----+----*/
+#ifndef _SEARCHSTATS_H_
+#define _SEARCHSTATS_H_
+
+#include <algorithm>
+#include <vector>
+
+#ifdef DOMEGA_STATS
+static const bool statsEnabled = true; /**< Whether the statistics are collected */
+#else
+static const bool statsEnabled = false; /**< Whether the statistics are collected */
+#endif
+
+/**
+ * Span of time of a worker, written as a complete event of the Chrome trace
+ * format.
+ */
+struct traceEvent
+{
+    const char *name; /**< Phase */
+    int clq; /**< Clique size tested (0 if none) */
+    double begin; /**< Seconds since the start of the run */
+    double duration; /**< Seconds */
+};
+
+/**
+ * Sizes of the graphs that reach a stage of the kernelization.
+ */
+struct kernelSizes
+{
+    long long numGraphs = 0; /**< Graphs */
+    long long vertices = 0; /**< Vertices, added over the graphs */
+    long long edges = 0; /**< Edges, added over the graphs */
+    int maxVertices = 0; /**< Vertices of the largest graph */
+
+    /**
+     * Counts a graph with n vertices and m edges.
+     */
+    inline void add(
+        int n,
+        int m)
+    {
+        numGraphs++;
+        vertices += n;
+        edges += m;
+        maxVertices = std::max(maxVertices, n);
+    }
+
+    /**
+     * Counts the graphs of other.
+     */
+    inline void merge(
+        const kernelSizes &other)
+    {
+        numGraphs += other.numGraphs;
+        vertices += other.vertices;
+        edges += other.edges;
+        maxVertices = std::max(maxVertices, other.maxVertices);
+    }
+};
+
+/**
+ * Statistics of a worker.
+ */
+struct workerStats
+{
+    long long numSubgraphs = 0; /**< Subgraphs taken from the cache */
+    long long numBussDecided = 0; /**< Subgraphs decided by the Buss kernel */
+    long long numNTDecided = 0; /**< Subgraphs decided by the NT kernel */
+    long long numSearched = 0; /**< Kernels solved by the vertex cover search */
+    kernelSizes input; /**< Subgraphs given to the Buss kernel */
+    kernelSizes buss; /**< Buss kernels given to the NT kernel */
+    kernelSizes nt; /**< NT kernels given to the vertex cover search */
+    double subgraphTime = 0; /**< Seconds spent taking the subgraphs from the
+    * cache, generating them if needed */
+    double bussTime = 0; /**< Seconds spent in the Buss kernel */
+    double ntTime = 0; /**< Seconds spent in the NT kernel */
+    double searchTime = 0; /**< Seconds spent in the vertex cover search
+    * (@see VertexCover::searchTime) */
+    std::vector<double> busyTime; /**< Seconds the worker processed its clique
+    * size, in every iteration */
+    std::vector<traceEvent> events; /**< Spans of the worker */
+    std::vector<long long> depthNodes; /**< Vertex cover search nodes at every
+    * depth */
+    std::vector<double> depthTime; /**< Seconds spent at the search nodes of every
+    * depth, without the time of their children */
+
+    /**
+     * Counts a search node at the given depth.
+     */
+    inline void countDepth(
+        int depth)
+    {
+        if ((int)depthNodes.size() <= depth)
+        {
+            depthNodes.resize(depth + 1, 0);
+            depthTime.resize(depth + 1, 0);
+        }
+        depthNodes[depth]++;
+    }
+
+    /**
+     * Adds the counters and the times of other (but not its spans).
+     */
+    inline void merge(
+        const workerStats &other)
+    {
+        numSubgraphs += other.numSubgraphs;
+        numBussDecided += other.numBussDecided;
+        numNTDecided += other.numNTDecided;
+        numSearched += other.numSearched;
+        input.merge(other.input);
+        buss.merge(other.buss);
+        nt.merge(other.nt);
+        subgraphTime += other.subgraphTime;
+        bussTime += other.bussTime;
+        ntTime += other.ntTime;
+        searchTime += other.searchTime;
+
+        if (depthNodes.size() < other.depthNodes.size())
+        {
+            depthNodes.resize(other.depthNodes.size(), 0);
+            depthTime.resize(other.depthTime.size(), 0);
+        }
+
+        for (size_t d = 0; d < other.depthNodes.size(); d++)
+        {
+            depthNodes[d] += other.depthNodes[d];
+            depthTime[d] += other.depthTime[d];
+        }
+    }
+};
+#endif // _SEARCHSTATS_H_
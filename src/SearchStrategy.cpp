@@ -0,0 +1,128 @@
+/**@file SearchStrategy.cpp
+ *
+ * @brief Strategies that pick the clique sizes tested by the clique search.
+ *
+ * @author Jose L. Walteros
+ *
+ * @version   1.0
+ * @date      June 2018
+ *
+ * Copyright (C) 2018 Jose L. Walteros. All rights reserved.
+ *
+ *---+----+----+----+----+----+----+----+----+----+----+----+----+----+----+----*/
+#include <math.h>
+#include <algorithm>
+#include <cstring>
+#include "SearchStrategy.h"
+
+static const char *strategyNames[] = {"linear", "binary", "galloping", "race"};
+
+std::unique_ptr<SearchStrategy> SearchStrategy::create(
+    kind type)
+{
+    switch (type)
+    {
+    case binary:
+        return std::unique_ptr<SearchStrategy>(new BinarySearch());
+    case galloping:
+        return std::unique_ptr<SearchStrategy>(new GallopingSearch());
+    case race:
+        return std::unique_ptr<SearchStrategy>(new RaceSearch());
+    default:
+        return std::unique_ptr<SearchStrategy>(new LinearSearch());
+    }
+}
+
+const char *SearchStrategy::name(
+    kind type)
+{
+    return strategyNames[type];
+}
+
+bool SearchStrategy::parse(
+    const char *name,
+    kind &type)
+{
+    for (int i = linear; i <= race; i++)
+    {
+        if (strcmp(name, strategyNames[i]) == 0)
+        {
+            type = (kind)i;
+            return true;
+        }
+    }
+    return false;
+}
+
+void LinearSearch::next(
+    int,
+    int cliqueUB,
+    int,
+    std::vector<int> &sizes)
+{
+    sizes.assign(1, cliqueUB);
+}
+
+void BinarySearch::next(
+    int cliqueLB,
+    int cliqueUB,
+    int,
+    std::vector<int> &sizes)
+{
+    sizes.assign(1, ceil((cliqueLB + cliqueUB) * 0.5));
+}
+
+void GallopingSearch::next(
+    int cliqueLB,
+    int cliqueUB,
+    int,
+    std::vector<int> &sizes)
+{
+    if (bracketed)
+    {
+        sizes.assign(1, ceil((cliqueLB + cliqueUB) * 0.5));
+    }
+    else
+    {
+        sizes.assign(1, std::max(cliqueLB + 1, cliqueUB + 1 - step));
+    }
+}
+
+void GallopingSearch::update(
+    int,
+    bool found,
+    double seconds)
+{
+    if (found)
+    {
+        bracketed = true;
+        return;
+    }
+
+    /**
+     * The step only grows when the failures get expensive; while they stay
+     * cheap, walking down one size at a time is the safest choice.
+     */
+    if ((lastFailure > 0) && (seconds >= growth * lastFailure))
+    {
+        step *= 2;
+    }
+    lastFailure = seconds;
+}
+
+void RaceSearch::next(
+    int cliqueLB,
+    int cliqueUB,
+    int numThreads,
+    std::vector<int> &sizes)
+{
+    int gap = cliqueUB - cliqueLB;
+    int numGroups = (numThreads < maxGroups) ? numThreads : maxGroups;
+    numGroups = std::max(std::min(numGroups, gap), 1);
+    sizes.clear();
+
+    for (int j = 0; j < numGroups; j++)
+    {
+        sizes.push_back(cliqueUB - (j * gap) / numGroups);
+    }
+}
@@ -0,0 +1,169 @@
+/**@file SearchStrategy.h
+ *
+ * @brief Strategies that pick the clique sizes tested by the clique search.
+ *
+ * @details The search keeps a lower bound LB (the size of a clique that has
+ * been found) and an upper bound UB of the clique number, and every iteration
+ * tests whether the graph has a clique of size clq for some LB < clq <= UB. A
+ * success sets LB = clq and a failure sets UB = clq - 1, until LB = UB. The
+ * strategy decides which sizes are tested:
+ *
+ * - Linear search tests clq = UB, so every iteration but the last one fails.
+ *   The failures are cheap when the clique-core gap is small, since the vertex
+ *   cover problems of the subgraphs have a small k.
+ * - Binary search tests the middle of the interval, which needs fewer
+ *   iterations when the gap is large.
+ * - Galloping search walks down from UB like the linear search, but doubles
+ *   its step whenever a failure takes twice as long as the previous one (the
+ *   cost of a failure grows with UB - clq). Once a clique has been found the
+ *   remaining interval is bisected.
+ * - Race search tests several sizes of the interval at the same time, each one
+ *   on its own group of workers (@see Clique::findMaxClique).
+ *
+ * @author Jose L. Walteros
+ *
+ * @version   1.0
+ * @date      June 2018
+ *
+ * Copyright (C) 2018 Jose L. Walteros. All rights reserved.
+ *
+ *---+----+----+----+----+----+----+----+----+----+----+----+----+----+----+----*/
+#ifndef _SEARCHSTRATEGY_H_
+#define _SEARCHSTRATEGY_H_
+
+#include <memory>
+#include <vector>
+
+class SearchStrategy
+{
+public:
+    /**
+     * Available strategies.
+     */
+    enum kind
+    {
+        linear, /**< @see LinearSearch */
+        binary, /**< @see BinarySearch */
+        galloping, /**< @see GallopingSearch */
+        race /**< @see RaceSearch */
+    };
+
+    virtual ~SearchStrategy() {}
+
+    /**
+     * Clique sizes to be tested in the next iteration.
+     *
+     * @param[in] cliqueLB : Lower bound of the clique number.
+     * @param[in] cliqueUB : Upper bound of the clique number (> cliqueLB).
+     * @param[in] numThreads : Number of workers available.
+     * @param[out] sizes : Between 1 and numThreads distinct sizes in
+     * (cliqueLB, cliqueUB], in decreasing order.
+     */
+    virtual void next(
+        int cliqueLB,
+        int cliqueUB,
+        int numThreads,
+        std::vector<int> &sizes) = 0;
+
+    /**
+     * Outcome of a clique size that was tested to the end (the sizes whose
+     * outcome was implied by another size of a race are not reported).
+     *
+     * @param[in] clq : Clique size.
+     * @param[in] found : Whether the graph has a clique of size clq.
+     * @param[in] seconds : Time the test took.
+     */
+    virtual void update(
+        int,
+        bool,
+        double) {}
+
+    /**
+     * Creates a strategy of the given kind.
+     */
+    static std::unique_ptr<SearchStrategy> create(
+        kind type);
+
+    /**
+     * Name of a kind of strategy, as given in the command line.
+     */
+    static const char *name(
+        kind type);
+
+    /**
+     * Finds the kind of strategy with the given name.
+     *
+     * @returns false if no strategy has that name.
+     */
+    static bool parse(
+        const char *name,
+        kind &type);
+};
+
+/**
+ * Tests clq = UB.
+ */
+class LinearSearch : public SearchStrategy
+{
+public:
+    void next(
+        int cliqueLB,
+        int cliqueUB,
+        int numThreads,
+        std::vector<int> &sizes);
+};
+
+/**
+ * Tests clq = ceil((LB + UB) / 2).
+ */
+class BinarySearch : public SearchStrategy
+{
+public:
+    void next(
+        int cliqueLB,
+        int cliqueUB,
+        int numThreads,
+        std::vector<int> &sizes);
+};
+
+/**
+ * Tests clq = UB + 1 - step, doubling the step when the cost of the failures
+ * grows quickly, and bisects the interval once a clique has been found.
+ */
+class GallopingSearch : public SearchStrategy
+{
+public:
+    static constexpr double growth = 2.0; /**< Cost ratio between consecutive
+    * failures that doubles the step */
+
+    int step = 1; /**< Distance between UB + 1 and the next size */
+    double lastFailure = 0; /**< Time of the last failure (0 if none) */
+    bool bracketed = false; /**< Whether a clique has been found */
+
+    void next(
+        int cliqueLB,
+        int cliqueUB,
+        int numThreads,
+        std::vector<int> &sizes);
+
+    void update(
+        int clq,
+        bool found,
+        double seconds);
+};
+
+/**
+ * Spreads up to maxGroups sizes evenly over (LB, UB], starting with UB.
+ */
+class RaceSearch : public SearchStrategy
+{
+public:
+    static const int maxGroups = 4; /**< Largest number of sizes tested at a time */
+
+    void next(
+        int cliqueLB,
+        int cliqueUB,
+        int numThreads,
+        std::vector<int> &sizes);
+};
+#endif // _SEARCHSTRATEGY_H_
@@ -0,0 +1,236 @@
+/**@file SmallVertexCover.cpp
+ *
+ * @brief Finds if a small graph has a vertex cover of size k, with the number
+ * of words per row and k as template parameters.
+ *
+ * @author Jose L. Walteros
+ *
+ * @version   1.0
+ * @date      June 2018
+ *
+ * Copyright (C) 2018 Jose L. Walteros. All rights reserved.
+ *
+ *---+----+----+----+----+----+----+----+----+----+----+----+----+----+----+----*/
+#include <vector>
+#include "SmallVertexCover.h"
+
+static_assert(SmallVertexCover::maxK == 8, "searchAt must have a case for every k");
+
+/**
+ * Set of vertices of a graph with at most 64 * W vertices.
+ */
+template <int W>
+struct wordSet
+{
+    uint64_t word[W]; /**< Bit i % 64 of word i / 64 is vertex i */
+};
+
+template <int W, int K>
+static bool search(
+    const uint64_t *rows,
+    const wordSet<W> &alive,
+    const wordSet<W> &taken,
+    wordSet<W> &cover,
+    long long &numNodes);
+
+/**
+ * search<W, k> for a k known at run time.
+ */
+template <int W>
+static bool searchAt(
+    int k,
+    const uint64_t *rows,
+    const wordSet<W> &alive,
+    const wordSet<W> &taken,
+    wordSet<W> &cover,
+    long long &numNodes)
+{
+    switch (k)
+    {
+    case 0:
+        return search<W, 0>(rows, alive, taken, cover, numNodes);
+    case 1:
+        return search<W, 1>(rows, alive, taken, cover, numNodes);
+    case 2:
+        return search<W, 2>(rows, alive, taken, cover, numNodes);
+    case 3:
+        return search<W, 3>(rows, alive, taken, cover, numNodes);
+    case 4:
+        return search<W, 4>(rows, alive, taken, cover, numNodes);
+    case 5:
+        return search<W, 5>(rows, alive, taken, cover, numNodes);
+    case 6:
+        return search<W, 6>(rows, alive, taken, cover, numNodes);
+    case 7:
+        return search<W, 7>(rows, alive, taken, cover, numNodes);
+    default:
+        return search<W, 8>(rows, alive, taken, cover, numNodes);
+    }
+}
+
+/**
+ * Node of the recursion: finds if the graph induced by alive has a vertex
+ * cover of size K. If it does, cover gets it together with taken.
+ */
+template <int W, int K>
+static bool search(
+    const uint64_t *rows,
+    const wordSet<W> &alive,
+    const wordSet<W> &taken,
+    wordSet<W> &cover,
+    long long &numNodes)
+{
+    numNodes++;
+    int a = -1;
+    int degreeA = 0;
+    int leaf = -1;
+    int sumDegrees = 0;
+
+    for (int w = 0; w < W; w++)
+    {
+        for (uint64_t word = alive.word[w]; word != 0; word &= word - 1)
+        {
+            int u = w * 64 + __builtin_ctzll(word);
+            int degree = 0;
+
+            for (int x = 0; x < W; x++)
+            {
+                degree += __builtin_popcountll(rows[u * W + x] & alive.word[x]);
+            }
+            sumDegrees += degree;
+
+            if (degree > degreeA)
+            {
+                a = u;
+                degreeA = degree;
+            }
+
+            if ((degree == 1) && (leaf == -1))
+            {
+                leaf = u;
+            }
+        }
+    }
+
+    if (degreeA == 0)
+    {
+        cover = taken;
+        return true;
+    }
+
+    if ((K == 0) || (sumDegrees / 2 > K * degreeA))
+    {
+        return false;
+    }
+    const int next = (K > 0) ? K - 1 : 0;
+    wordSet<W> upperAlive = alive;
+    wordSet<W> upperTaken = taken;
+
+    /**
+     * The neighbor of a vertex of degree 1 and a vertex of degree larger than
+     * K are in the vertex cover, so the node does not branch.
+     */
+    if ((leaf != -1) || (degreeA > K))
+    {
+        int b = a;
+
+        if (leaf != -1)
+        {
+            for (int w = 0; w < W; w++)
+            {
+                uint64_t word = rows[leaf * W + w] & alive.word[w];
+
+                if (word != 0)
+                {
+                    b = w * 64 + __builtin_ctzll(word);
+                    break;
+                }
+            }
+        }
+        upperAlive.word[b >> 6] &= ~(uint64_t(1) << (b & 63));
+        upperTaken.word[b >> 6] |= uint64_t(1) << (b & 63);
+        return search<W, next>(rows, upperAlive, upperTaken, cover, numNodes);
+    }
+
+    /**
+     * Upper branch: a is in the vertex cover. Lower branch: N(a) is.
+     */
+    upperAlive.word[a >> 6] &= ~(uint64_t(1) << (a & 63));
+    upperTaken.word[a >> 6] |= uint64_t(1) << (a & 63);
+
+    if (search<W, next>(rows, upperAlive, upperTaken, cover, numNodes))
+    {
+        return true;
+    }
+    wordSet<W> lowerAlive = upperAlive;
+    wordSet<W> lowerTaken = taken;
+
+    for (int w = 0; w < W; w++)
+    {
+        uint64_t neighbors = rows[a * W + w] & alive.word[w];
+        lowerAlive.word[w] &= ~neighbors;
+        lowerTaken.word[w] |= neighbors;
+    }
+    return searchAt<W>(K - degreeA, rows, lowerAlive, lowerTaken, cover, numNodes);
+}
+
+/**
+ * SmallVertexCover::solve for rows of W words.
+ */
+template <int W>
+static bool solveWords(
+    const uint64_t *rows,
+    int n,
+    int k,
+    std::vector<int> &cover,
+    long long &numNodes)
+{
+    wordSet<W> alive;
+    wordSet<W> taken;
+    wordSet<W> found;
+
+    for (int w = 0; w < W; w++)
+    {
+        alive.word[w] = 0;
+        taken.word[w] = 0;
+    }
+
+    for (int i = 0; i < n; i++)
+    {
+        alive.word[i >> 6] |= uint64_t(1) << (i & 63);
+    }
+
+    if (!searchAt<W>(k, rows, alive, taken, found, numNodes))
+    {
+        return false;
+    }
+    cover.clear();
+
+    for (int w = 0; w < W; w++)
+    {
+        for (uint64_t word = found.word[w]; word != 0; word &= word - 1)
+        {
+            cover.push_back(w * 64 + __builtin_ctzll(word));
+        }
+    }
+    return true;
+}
+
+bool SmallVertexCover::solve(
+    const uint64_t *rows,
+    int n,
+    int k,
+    std::vector<int> &cover,
+    long long &numNodes)
+{
+    if (k < 0)
+    {
+        return false;
+    }
+
+    if (n <= 64)
+    {
+        return solveWords<1>(rows, n, k, cover, numNodes);
+    }
+    return solveWords<2>(rows, n, k, cover, numNodes);
+}
@@ -0,0 +1,66 @@
+/**@file SmallVertexCover.h
+ *
+ * @brief Finds if a graph with at most 64 * SmallVertexCover::maxWords
+ * vertices has a vertex cover of size k <= SmallVertexCover::maxK.
+ *
+ * @details Most of the nodes at the bottom of the vertex cover recursion have a
+ * small graph and a small k. For them, the recursion is replaced by one whose
+ * number of words per row and k are template parameters: the sets of vertices
+ * are held in registers, the loops over their words are unrolled, and every
+ * level of the recursion is a separate function. Every node takes the
+ * neighbor of a vertex of degree 1 or a vertex of degree larger than k, if
+ * there is one, and otherwise branches on the vertex a with the largest
+ * degree: a is in the vertex cover, or N(a) is. The node is pruned if the
+ * graph has more than k times the largest degree edges.
+ *
+ * @author Jose L. Walteros
+ *
+ * @version   1.0
+ * @date      June 2018
+ *
+ * Copyright (C) 2018 Jose L. Walteros. All rights reserved.
+ *
+ *---+----+----+----+----+----+----+----+----+----+----+----+----+----+----+----*/
+#ifndef _SMALLVERTEXCOVER_H_
+#define _SMALLVERTEXCOVER_H_
+
+#include <cstdint>
+#include <vector>
+
+class SmallVertexCover
+{
+public:
+    static const int maxK = 8; /**< Largest k solved */
+    static const int maxWords = 2; /**< Largest number of words of the rows */
+
+    /**
+     * Whether a graph with n vertices and a vertex cover of size k is solved
+     * by SmallVertexCover::solve.
+     */
+    static inline bool fits(
+        int n,
+        int k)
+    {
+        return (k <= maxK) && (n <= 64 * maxWords);
+    }
+
+    /**
+     * Finds if a graph has a vertex cover of size k. The graph must fit
+     * (@see SmallVertexCover::fits).
+     *
+     * @param[in] rows : Adjacency matrix, one bitset of (n + 63) / 64 words per
+     * vertex (@see Bitset).
+     * @param[in] n : Number of vertices.
+     * @param[in] k : Size of the vertex cover.
+     * @param[out] cover : Vertices of a vertex cover of size at most k, if
+     * there is one.
+     * @param[in,out] numNodes : Nodes of the recursion, which are added to it.
+     */
+    static bool solve(
+        const uint64_t *rows,
+        int n,
+        int k,
+        std::vector<int> &cover,
+        long long &numNodes);
+};
+#endif // _SMALLVERTEXCOVER_H_
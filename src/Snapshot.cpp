@@ -0,0 +1,222 @@
+/**@file Snapshot.cpp
+ *
+ * @brief Binary snapshot of a graph in CSR form.
+ *
+ * @details The file starts with a snapshotHeader followed by the arrays
+ * EdgesBegin (n + 1 entries), EdgeTo (numArcs entries), alias (n entries) and,
+ * if the ordering is stored, ordering, position and rightDegree (n entries
+ * each). Every array starts at a multiple of Snapshot::alignment bytes.
+ *
+ * @author Jose L. Walteros
+ *
+ * @version   1.0
+ * @date      June 2018
+ *
+ * Copyright (C) 2018 Jose L. Walteros. All rights reserved.
+ *
+ *---+----+----+----+----+----+----+----+----+----+----+----+----+----+----+----*/
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <vector>
+#include "Snapshot.h"
+#include "MappedFile.h"
+#include "Graph.h"
+
+static const char snapshotMagic[8] = {'d', 'O', 'm', 'e', 'g', 'a', 'C', 'S'};
+
+/**
+ * Number of bytes used by an array of count ints, including the padding that
+ * aligns the next array.
+ */
+static size_t paddedSize(
+    size_t count)
+{
+    size_t bytes = count * sizeof(int32_t);
+    return (bytes + Snapshot::alignment - 1) / Snapshot::alignment * Snapshot::alignment;
+}
+
+/**
+ * Writes count ints followed by the padding that aligns the next array.
+ */
+static void writeArray(
+    std::ofstream &file,
+    const int *values,
+    size_t count)
+{
+    static const char zeros[Snapshot::alignment] = {0};
+    file.write(reinterpret_cast<const char *>(values), count * sizeof(int32_t));
+    file.write(zeros, paddedSize(count) - count * sizeof(int32_t));
+}
+
+/**
+ * Copies count ints from the mapped file into values and advances offset. Returns
+ * false if the file is too short.
+ */
+static bool readArray(
+    const MappedFile &file,
+    size_t &offset,
+    std::vector<int> &values,
+    size_t count)
+{
+    if (offset + count * sizeof(int32_t) > file.size)
+    {
+        return false;
+    }
+    values = std::vector<int>(count);
+
+    if (count > 0)
+    {
+        memcpy(values.data(), file.data + offset, count * sizeof(int32_t));
+    }
+    offset += paddedSize(count);
+    return true;
+}
+
+bool Snapshot::write(
+    const Graph &graph,
+    const char *filename,
+    bool withOrdering)
+{
+    std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+
+    if (!file)
+    {
+        std::cerr << "ERROR: could not open file '" << filename <<
+        " for writing" << std::endl;
+        return false;
+    }
+
+    snapshotHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, snapshotMagic, sizeof(header.magic));
+    header.version = version;
+    header.byteOrder = byteOrder;
+    header.flags = (withOrdering && graph.ordered) ? hasOrdering : 0;
+    header.n = graph.n;
+    header.m = graph.m;
+    header.numArcs = graph.EdgeTo.size();
+    header.delta = graph.delta;
+    header.Delta = graph.Delta;
+
+    if (header.flags & hasOrdering)
+    {
+        header.d = graph.d;
+        header.cliqueLB = graph.cliqueLB;
+        header.cliqueUB = graph.cliqueUB;
+    }
+
+    static const char zeros[alignment] = {0};
+    file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    file.write(zeros, alignment - sizeof(header) % alignment);
+
+    std::vector<int> edgesBegin(graph.EdgesBegin);
+    edgesBegin.push_back(header.numArcs);
+    writeArray(file, edgesBegin.data(), edgesBegin.size());
+    writeArray(file, graph.EdgeTo.data(), graph.EdgeTo.size());
+    writeArray(file, graph.alias.data(), graph.alias.size());
+
+    if (header.flags & hasOrdering)
+    {
+        writeArray(file, graph.ordering.data(), graph.ordering.size());
+        writeArray(file, graph.position.data(), graph.position.size());
+        writeArray(file, graph.rightDegree.data(), graph.rightDegree.size());
+    }
+
+    if (!file)
+    {
+        std::cerr << "ERROR: when writing the snapshot to file '" << filename << "'" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+bool Snapshot::read(
+    Graph &graph,
+    const char *filename)
+{
+    MappedFile file(filename);
+
+    if (!file.open)
+    {
+        std::cerr << "ERROR: could not open file '" << filename <<
+        " for reading" << std::endl;
+        return false;
+    }
+
+    snapshotHeader header;
+
+    if (file.size < sizeof(header))
+    {
+        std::cerr << "ERROR: file '" << filename << "' is not a snapshot" << std::endl;
+        return false;
+    }
+    memcpy(&header, file.data, sizeof(header));
+
+    if ((memcmp(header.magic, snapshotMagic, sizeof(header.magic)) != 0) || (header.byteOrder != byteOrder))
+    {
+        std::cerr << "ERROR: file '" << filename << "' is not a snapshot or was written with a different byte order" << std::endl;
+        return false;
+    }
+
+    if (header.version != version)
+    {
+        std::cerr << "ERROR: snapshot '" << filename << "' has version " <<
+        header.version << " (expected " << version << ")" << std::endl;
+        return false;
+    }
+
+    if ((header.n <= 0) || (header.numArcs < 0))
+    {
+        std::cerr << "ERROR: when reading the graph from file '" << filename << "'" << std::endl;
+        return false;
+    }
+
+    size_t offset = (sizeof(header) / alignment + 1) * alignment;
+    std::vector<int> edgesBegin;
+    bool complete = readArray(file, offset, edgesBegin, header.n + 1) &&
+                    readArray(file, offset, graph.EdgeTo, header.numArcs) &&
+                    readArray(file, offset, graph.alias, header.n);
+
+    if (complete && (header.flags & hasOrdering))
+    {
+        complete = readArray(file, offset, graph.ordering, header.n) &&
+                   readArray(file, offset, graph.position, header.n) &&
+                   readArray(file, offset, graph.rightDegree, header.n);
+    }
+
+    if (!complete)
+    {
+        std::cerr << "ERROR: snapshot '" << filename << "' is truncated" << std::endl;
+        return false;
+    }
+
+    graph.n = header.n;
+    graph.m = header.m;
+    graph.delta = header.delta;
+    graph.Delta = header.Delta;
+    graph.degree = std::vector<int>(graph.n);
+    edgesBegin.pop_back();
+
+    for (int i = 0; i < graph.n; i++)
+    {
+        graph.degree[i] = ((i + 1 < graph.n) ? edgesBegin[i + 1] : header.numArcs) - edgesBegin[i];
+    }
+    graph.EdgesBegin.swap(edgesBegin);
+
+    if (header.flags & hasOrdering)
+    {
+        graph.d = header.d;
+        graph.cliqueLB = header.cliqueLB;
+        graph.cliqueUB = header.cliqueUB;
+        graph.ordered = true;
+    }
+    else
+    {
+        graph.rightDegree = std::vector<int>(graph.n, 0);
+        graph.position = std::vector<int>(graph.n, 0);
+        graph.ordering = std::vector<int>(graph.n, 0);
+        graph.ordered = false;
+    }
+    return true;
+}
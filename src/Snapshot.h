@@ -0,0 +1,87 @@
+/**@file Snapshot.h
+ *
+ * @brief Binary snapshot of a graph in CSR form.
+ *
+ * @details A snapshot stores the CSR arrays of a graph (EdgesBegin, EdgeTo and
+ * alias) and, optionally, its degeneracy ordering (ordering, position and
+ * rightDegree) and the bounds obtained from it (d, cliqueLB and cliqueUB).
+ * Reading a snapshot avoids both parsing the text file and, if the ordering is
+ * stored, the degeneracy pass of the clique algorithm.
+ *
+ * The file starts with a snapshotHeader followed by the arrays. Every array
+ * starts at a multiple of Snapshot::alignment bytes, so a mapped file can be
+ * used in place. The header records the version of the format and the byte
+ * order of the machine that wrote it; files with a different version or byte
+ * order are rejected.
+ *
+ * @author Jose L. Walteros
+ *
+ * @version   1.0
+ * @date      June 2018
+ *
+ * Copyright (C) 2018 Jose L. Walteros. All rights reserved.
+ *
+ *---+----+----+----+----+----+----+----+----+----+----+----+----+----+----+----*/
+#ifndef _SNAPSHOT_H_
+#define _SNAPSHOT_H_
+
+#include <cstdint>
+#include "Graph.h"
+
+/**
+ * Header of a snapshot file.
+ */
+struct snapshotHeader
+{
+    char magic[8]; /**< "dOmegaCS" */
+    uint32_t version; /**< Version of the format */
+    uint32_t byteOrder; /**< Snapshot::byteOrder in the writer's byte order */
+    uint32_t flags; /**< Snapshot::hasOrdering if the ordering is stored */
+    int32_t n; /**< Number of vertices */
+    int32_t m; /**< Number of edges */
+    int32_t numArcs; /**< Number of entries of EdgeTo */
+    int32_t delta; /**< Min degree */
+    int32_t Delta; /**< Max degree */
+    int32_t d; /**< Degeneracy (if the ordering is stored) */
+    int32_t cliqueLB; /**< Lower bound from the ordering (if stored) */
+    int32_t cliqueUB; /**< Upper bound from the ordering (if stored) */
+    int32_t reserved; /**< Padding, always 0 */
+};
+
+class Snapshot
+{
+public:
+    static const uint32_t version = 1; /**< Current version of the format */
+    static const uint32_t byteOrder = 0x01020304; /**< Byte order mark */
+    static const uint32_t hasOrdering = 1; /**< Flag: the ordering is stored */
+    static const size_t alignment = 64; /**< Alignment of the arrays */
+
+    /**
+     * Writes the graph to a snapshot file.
+     *
+     * @param[in] graph : The graph.
+     * @param[in] filename : Name of the snapshot file.
+     * @param[in] withOrdering : Whether to store the degeneracy ordering. The
+     * ordering must have been computed (@see Graph::computeDegeneracyOrdering).
+     *
+     * @returns true if the file was written.
+     */
+    static bool write(
+        const Graph &graph,
+        const char *filename,
+        bool withOrdering);
+
+    /**
+     * Reads a snapshot file into the graph. If the snapshot stores the
+     * ordering, graph.ordered is set to true.
+     *
+     * @param[out] graph : The graph.
+     * @param[in] filename : Name of the snapshot file.
+     *
+     * @returns true if the file was read.
+     */
+    static bool read(
+        Graph &graph,
+        const char *filename);
+};
+#endif // _SNAPSHOT_H_
@@ -0,0 +1,44 @@
+/**@file SolverContext.h
+ *
+ * @brief Workers and scratch data of the search, shared by consecutive runs.
+ *
+ * @details A Clique built from a graph alone creates its own context. A
+ * context built once and given to the Clique objects of several graphs keeps
+ * its threads and the arenas of its vertex cover solvers and NT kernels from
+ * one graph to the next, so the later runs do not create threads or grow
+ * their scratch memory again (@see CliqueSolver). A context can only be used
+ * by one run at a time.
+ *
+ * @author Jose L. Walteros
+ *
+ * @version   1.0
+ * @date      June 2018
+ *
+ * Copyright (C) 2018 Jose L. Walteros. All rights reserved.
+ *
+ *---+----+----+----+----+----+----+----+----+----+----+----+----+----+----+----*/
+#ifndef _SOLVERCONTEXT_H_
+#define _SOLVERCONTEXT_H_
+
+#include <vector>
+#include "ThreadPool.h"
+#include "VertexCover.h"
+#include "NemhauserTrotter.h"
+
+class SolverContext
+{
+public:
+    ThreadPool pool; /**< Workers */
+    std::vector<VertexCover> solvers; /**< Vertex cover solver of each worker */
+    std::vector<ntWorkspace> ntWorkspaces; /**< Arrays of the NT kernels of each
+    * worker */
+
+    /**
+     * SolverContext constructor.
+     *
+     * @param[in] numThreads : Number of workers.
+     */
+    inline SolverContext(
+        int numThreads) : pool(numThreads), solvers(pool.size()), ntWorkspaces(pool.size()) {}
+};
+#endif // _SOLVERCONTEXT_H_
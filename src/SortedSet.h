@@ -0,0 +1,165 @@
+/**@file SortedSet.h
+ *
+ * @brief Intersection of sorted arrays of vertex ids, used to build the
+ * complement subgraphs (@see Graph::generateCompGraphRightNeighbors).
+ *
+ * @details The procedures mark, in a bitset, the elements of a sorted array a
+ * that also belong to a sorted array b. If b is much longer than a, the
+ * elements of a are searched in b with galloping (exponential and then binary
+ * search, Bentley and Yao (1976)). Otherwise the arrays are merged by blocks:
+ * every block of a is compared with every element of a block of b, and the
+ * block that ends first is replaced (in the spirit of the V1 intersection of
+ * D. Lemire, L. Boytsov and N. Kurz, SIMD compression and the intersection of
+ * sorted integers, 2016). The blocks have 16 ids with AVX-512 and 8 with AVX2
+ * (compiled with, e.g., make ARCH=-march=native). The rest of the arrays is
+ * merged one element at a time without branches.
+ *
+ * @author Jose L. Walteros
+ *
+ * @version   1.0
+ * @date      June 2018
+ *
+ * Copyright (C) 2018 Jose L. Walteros. All rights reserved.
+ *
+ *---+----+----+----+----+----+----+----+----+----+----+----+----+----+----+----*/
+#ifndef _SORTEDSET_H_
+#define _SORTEDSET_H_
+
+#include <algorithm>
+#include <cstdint>
+#if defined(__AVX2__) || defined(__AVX512F__)
+#include <immintrin.h>
+#endif
+
+class SortedSet
+{
+public:
+    static const int gallopRatio = 32; /**< Smallest ratio between the lengths of
+    * b and a for which the elements of a are searched by galloping */
+
+    /**
+     * Sets bit offset + k of bits for every a[k] that belongs to b. Both arrays
+     * must be sorted and without repetitions. The other bits are not changed.
+     */
+    static inline void markCommon(
+        const int *a,
+        int numA,
+        const int *b,
+        int numB,
+        int offset,
+        uint64_t *bits)
+    {
+        if ((numA == 0) || (numB == 0))
+        {
+            return;
+        }
+
+        if (numB / gallopRatio >= numA)
+        {
+            gallop(a, numA, b, numB, offset, bits);
+            return;
+        }
+        int i = 0;
+        int j = 0;
+#if defined(__AVX512F__)
+        while ((i + 16 <= numA) && (j + 16 <= numB))
+        {
+            __m512i x = _mm512_loadu_si512(a + i);
+            __mmask16 found = 0;
+
+            for (int r = 0; r < 16; r++)
+            {
+                found |= _mm512_cmpeq_epi32_mask(x, _mm512_set1_epi32(b[j + r]));
+            }
+            setBits(bits, offset + i, found);
+            int lastA = a[i + 15];
+            int lastB = b[j + 15];
+            i += 16 * (lastA <= lastB);
+            j += 16 * (lastB <= lastA);
+        }
+#elif defined(__AVX2__)
+        while ((i + 8 <= numA) && (j + 8 <= numB))
+        {
+            __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(a + i));
+            __m256i found = _mm256_setzero_si256();
+
+            for (int r = 0; r < 8; r++)
+            {
+                found = _mm256_or_si256(found, _mm256_cmpeq_epi32(x, _mm256_set1_epi32(b[j + r])));
+            }
+            setBits(bits, offset + i, _mm256_movemask_ps(_mm256_castsi256_ps(found)));
+            int lastA = a[i + 7];
+            int lastB = b[j + 7];
+            i += 8 * (lastA <= lastB);
+            j += 8 * (lastB <= lastA);
+        }
+#endif
+
+        while ((i < numA) && (j < numB))
+        {
+            int x = a[i];
+            int y = b[j];
+
+            if (x == y)
+            {
+                int k = offset + i;
+                bits[k >> 6] |= uint64_t(1) << (k & 63);
+            }
+            i += (x <= y);
+            j += (y <= x);
+        }
+    }
+
+private:
+    /**
+     * Sets bits first, first + 1, ... of bits to the bits of mask (at most 16).
+     */
+    static inline void setBits(
+        uint64_t *bits,
+        int first,
+        uint64_t mask)
+    {
+        int w = first >> 6;
+        int shift = first & 63;
+        bits[w] |= mask << shift;
+
+        if ((shift > 48) && ((mask >> (64 - shift)) != 0))
+        {
+            bits[w + 1] |= mask >> (64 - shift);
+        }
+    }
+
+    /**
+     * markCommon for a much shorter than b: every element of a is searched in
+     * the part of b after the previous one.
+     */
+    static inline void gallop(
+        const int *a,
+        int numA,
+        const int *b,
+        int numB,
+        int offset,
+        uint64_t *bits)
+    {
+        int j = 0;
+
+        for (int i = 0; (i < numA) && (j < numB); i++)
+        {
+            int step = 1;
+
+            while ((j + step < numB) && (b[j + step] < a[i]))
+            {
+                step *= 2;
+            }
+            j = std::lower_bound(b + j + step / 2, b + std::min(j + step + 1, numB), a[i]) - b;
+
+            if ((j < numB) && (b[j] == a[i]))
+            {
+                int k = offset + i;
+                bits[k >> 6] |= uint64_t(1) << (k & 63);
+                j++;
+            }
+        }
+    }
+};
+#endif // _SORTEDSET_H_
@@ -0,0 +1,502 @@
+/**@file StreamReader.cpp
+ *
+ * @brief Reader of edge lists with bounded memory, which may be compressed.
+ *
+ * @author Jose L. Walteros
+ *
+ * @version   1.0
+ * @date      June 2018
+ *
+ * Copyright (C) 2018 Jose L. Walteros. All rights reserved.
+ *
+ *---+----+----+----+----+----+----+----+----+----+----+----+----+----+----+----*/
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+#include <cstdio>
+#include <iostream>
+#include <queue>
+#include <unordered_map>
+#include <vector>
+#include "InputStream.h"
+#include "StreamReader.h"
+
+/**
+ * Renames the vertices in order of first appearance. The names in
+ * [0, 2n + 1024) are looked up in a table and the others in a hash map.
+ */
+struct vertexNames
+{
+    std::vector<int> &alias; /**< Name of every id */
+    std::vector<int> dense; /**< Id + 1 of the small names (0 if not seen) */
+    std::unordered_map<int, int> sparse; /**< Id of the other names */
+    int numNames = 0; /**< Names seen */
+
+    inline vertexNames(
+        std::vector<int> &alias) : alias(alias), dense(std::min(2LL * (long long)alias.size() + 1024, (long long)INT_MAX), 0) {}
+
+    /**
+     * Id of a name, which is given the next id if it was not seen.
+     *
+     * @returns -1 if there are already alias.size() names.
+     */
+    inline int id(
+        int name)
+    {
+        if ((name >= 0) && (name < (int)dense.size()))
+        {
+            if (dense[name] == 0)
+            {
+                if (numNames == (int)alias.size())
+                {
+                    return -1;
+                }
+                alias[numNames++] = name;
+                dense[name] = numNames;
+            }
+            return dense[name] - 1;
+        }
+        std::unordered_map<int, int>::iterator it = sparse.find(name);
+
+        if (it != sparse.end())
+        {
+            return it->second;
+        }
+
+        if (numNames == (int)alias.size())
+        {
+            return -1;
+        }
+        alias[numNames] = name;
+        sparse.emplace(name, numNames);
+        return numNames++;
+    }
+};
+
+/**
+ * Arc (u, v) as a key whose order is the one of the CSR.
+ */
+static inline uint64_t arcKey(
+    int u,
+    int v)
+{
+    return ((uint64_t)(uint32_t)u << 32) | (uint32_t)v;
+}
+
+/**
+ * Merges the sorted runs and calls visit(key) once for every distinct key, in
+ * increasing order. The blocks read from the runs split the size arcs of
+ * scratch.
+ *
+ * @returns false if a run could not be read.
+ */
+template <typename Visit>
+static bool mergeRuns(
+    const std::vector<FILE *> &runs,
+    uint64_t *scratch,
+    size_t size,
+    Visit visit)
+{
+    int numRuns = runs.size();
+    size_t block = size / numRuns;
+    std::vector<size_t> position(numRuns, 0);
+    std::vector<size_t> length(numRuns, 0);
+    typedef std::pair<uint64_t, int> head;
+    std::priority_queue<head, std::vector<head>, std::greater<head> > heads;
+    bool success = true;
+
+    /**
+     * Moves the next key of run r to the heap.
+     */
+    auto advance = [&](int r)
+    {
+        if (position[r] == length[r])
+        {
+            position[r] = 0;
+            length[r] = fread(scratch + r * block, sizeof(uint64_t), block, runs[r]);
+            success = success && !ferror(runs[r]);
+        }
+
+        if (position[r] < length[r])
+        {
+            heads.push(head(scratch[r * block + position[r]++], r));
+        }
+    };
+
+    for (int r = 0; r < numRuns; r++)
+    {
+        rewind(runs[r]);
+        advance(r);
+    }
+    bool first = true;
+    uint64_t last = 0;
+
+    while (!heads.empty())
+    {
+        head top = heads.top();
+        heads.pop();
+
+        if (first || (top.first != last))
+        {
+            visit(top.first);
+            last = top.first;
+            first = false;
+        }
+        advance(top.second);
+    }
+    return success;
+}
+
+/**
+ * Merges the last count runs into a new run, which replaces them and whose
+ * level is one more than the largest of theirs. The output is written in
+ * blocks of the same size as the ones read from the runs.
+ *
+ * @returns false if the runs could not be read or the new run written.
+ */
+static bool combineRuns(
+    std::vector<FILE *> &runs,
+    std::vector<int> &levels,
+    int count,
+    std::vector<uint64_t> &scratch)
+{
+    std::vector<FILE *> group(runs.end() - count, runs.end());
+    int level = *std::max_element(levels.end() - count, levels.end()) + 1;
+    size_t block = scratch.size() / (count + 1);
+    uint64_t *out = scratch.data() + count * block;
+    size_t used = 0;
+    FILE *run = tmpfile();
+    bool written = (run != nullptr);
+
+    auto flush = [&]()
+    {
+        written = written && (fwrite(out, sizeof(uint64_t), used, run) == used);
+        used = 0;
+    };
+
+    bool merged = mergeRuns(group, scratch.data(), count * block, [&](uint64_t key)
+    {
+        out[used++] = key;
+
+        if (used == block)
+        {
+            flush();
+        }
+    });
+    flush();
+
+    for (FILE *old : group)
+    {
+        fclose(old);
+    }
+    runs.resize(runs.size() - count);
+    levels.resize(levels.size() - count);
+
+    if (run != nullptr)
+    {
+        runs.push_back(run);
+        levels.push_back(level);
+    }
+    return merged && written;
+}
+
+bool StreamReader::read(
+    Graph &graph,
+    const char *filename,
+    long long budget,
+    int numThreads)
+{
+    InputStream input(filename);
+    int n = 0;
+    int m = 0;
+
+    if (!input.open)
+    {
+        std::cerr << "ERROR: could not open file '" << filename << " for reading" << std::endl;
+        return false;
+    }
+    input.nextInt(n);
+    input.nextInt(m);
+
+    if ((n <= 0) || (m <= 0))
+    {
+        std::cerr << "ERROR: when reading the graph from file '" << filename << std::endl;
+        return false;
+    }
+    graph.n = n;
+    graph.alias = std::vector<int>(n, 0);
+    vertexNames names(graph.alias);
+    int a;
+    int b;
+    int u;
+    int v;
+    long long numEdges = 0;
+
+    /**
+     * Reads the next edge (only the first m edges are read, as the other
+     * readers do). u or v is -1 if the file has more than n vertices.
+     */
+    auto nextEdge = [&]()
+    {
+        if ((numEdges < m) && input.nextInt(a) && input.nextInt(b))
+        {
+            u = names.id(a);
+            v = names.id(b);
+            numEdges++;
+            return true;
+        }
+        return false;
+    };
+
+    auto tooManyVertices = [&]()
+    {
+        std::cerr << "ERROR: file '" << filename << "' has more than " << n << " vertices" << std::endl;
+        return false;
+    };
+
+    auto malformed = [&]()
+    {
+        std::cerr << "ERROR: file '" << filename << "' has a token that is not an integer" << std::endl;
+        return false;
+    };
+
+    if ((2LL * m * (long long)sizeof(int) <= budget) && (2LL * m <= INT_MAX))
+    {
+        /**
+         * First pass: occurrences of every vertex (without the loops).
+         */
+        std::vector<int> cursor(n, 0);
+
+        while (nextEdge())
+        {
+            if ((u < 0) || (v < 0))
+            {
+                return tooManyVertices();
+            }
+
+            if (u != v)
+            {
+                cursor[u]++;
+                cursor[v]++;
+            }
+        }
+
+        if (input.malformed)
+        {
+            return malformed();
+        }
+
+        if (!input.close())
+        {
+            std::cerr << "ERROR: could not read file '" << filename << "'" << std::endl;
+            return false;
+        }
+        std::vector<int> rawBegin(n + 1, 0);
+
+        for (int i = 0; i < n; i++)
+        {
+            rawBegin[i + 1] = rawBegin[i] + cursor[i];
+            cursor[i] = rawBegin[i];
+        }
+
+        /**
+         * Second pass: the rows, with duplicates.
+         */
+        std::vector<int> raw(rawBegin[n]);
+        InputStream again(filename);
+        long long numRead = numEdges;
+        numEdges = 0;
+
+        if (!again.open || !again.nextInt(a) || !again.nextInt(b))
+        {
+            std::cerr << "ERROR: could not read file '" << filename << "'" << std::endl;
+            return false;
+        }
+
+        while ((numEdges < numRead) && again.nextInt(a) && again.nextInt(b))
+        {
+            u = names.id(a);
+            v = names.id(b);
+            numEdges++;
+
+            if (u != v)
+            {
+                raw[cursor[u]++] = v;
+                raw[cursor[v]++] = u;
+            }
+        }
+
+        if ((numEdges < numRead) || !again.close())
+        {
+            std::cerr << "ERROR: file '" << filename << "' changed while it was read" << std::endl;
+            return false;
+        }
+        std::vector<int>().swap(cursor);
+        graph.compactRows(raw, rawBegin, std::max(numThreads, 1));
+    }
+    else
+    {
+        /**
+         * The arcs are collected in sorted runs of at most budget bytes.
+         */
+        size_t capacity = std::max(budget / (long long)sizeof(uint64_t), (long long)minRunArcs);
+        std::vector<uint64_t> arcs;
+        std::vector<FILE *> runs;
+        std::vector<int> levels;
+        bool written = true;
+        arcs.reserve(capacity);
+
+        auto sortArcs = [&arcs]()
+        {
+            std::sort(arcs.begin(), arcs.end());
+            arcs.erase(std::unique(arcs.begin(), arcs.end()), arcs.end());
+        };
+
+        auto writeRun = [&]()
+        {
+            sortArcs();
+            FILE *run = tmpfile();
+            written = written && (run != nullptr) && (fwrite(arcs.data(), sizeof(uint64_t), arcs.size(), run) == arcs.size());
+
+            if (run != nullptr)
+            {
+                runs.push_back(run);
+                levels.push_back(0);
+            }
+
+            /**
+             * The levels of the runs never increase along the list, so the
+             * last maxFanIn runs have the same level if the first of them
+             * has the one of the last.
+             */
+            while (written && ((int)runs.size() >= maxFanIn) && (levels[runs.size() - maxFanIn] == levels.back()))
+            {
+                arcs.resize(capacity);
+                written = combineRuns(runs, levels, maxFanIn, arcs);
+            }
+            arcs.clear();
+        };
+
+        auto closeRuns = [&runs]()
+        {
+            for (FILE *run : runs)
+            {
+                fclose(run);
+            }
+        };
+
+        while (written && nextEdge())
+        {
+            if ((u < 0) || (v < 0))
+            {
+                closeRuns();
+                return tooManyVertices();
+            }
+
+            if (u != v)
+            {
+                if (arcs.size() + 2 > capacity)
+                {
+                    writeRun();
+                }
+                arcs.push_back(arcKey(u, v));
+                arcs.push_back(arcKey(v, u));
+            }
+        }
+
+        if (input.malformed)
+        {
+            closeRuns();
+            return malformed();
+        }
+
+        if (!written || !input.close())
+        {
+            std::cerr << "ERROR: could not read file '" << filename << "' or write its temporary runs" << std::endl;
+            closeRuns();
+            return false;
+        }
+
+        /**
+         * If everything fit in one buffer, it is used directly. Otherwise the
+         * buffer becomes the last run, and then the scratch of the merges.
+         */
+        if (runs.empty())
+        {
+            sortArcs();
+        }
+        else
+        {
+            writeRun();
+            arcs.resize(capacity);
+
+            while (written && ((int)runs.size() > maxFanIn))
+            {
+                written = combineRuns(runs, levels, maxFanIn, arcs);
+            }
+
+            if (!written)
+            {
+                std::cerr << "ERROR: could not write the temporary runs of file '" << filename << "'" << std::endl;
+                closeRuns();
+                return false;
+            }
+        }
+
+        graph.degree = std::vector<int>(n, 0);
+        long long numArcs = 0;
+        auto count = [&graph, &numArcs](uint64_t key)
+        {
+            graph.degree[key >> 32]++;
+            numArcs++;
+        };
+        bool merged = true;
+
+        if (runs.empty())
+        {
+            std::for_each(arcs.begin(), arcs.end(), count);
+        }
+        else
+        {
+            merged = mergeRuns(runs, arcs.data(), arcs.size(), count);
+        }
+
+        if (!merged || (numArcs > INT_MAX))
+        {
+            std::cerr << "ERROR: could not merge the runs of file '" << filename << "'" << std::endl;
+            closeRuns();
+            return false;
+        }
+        graph.EdgesBegin = std::vector<int>(n, 0);
+
+        for (int i = 1; i < n; i++)
+        {
+            graph.EdgesBegin[i] = graph.EdgesBegin[i - 1] + graph.degree[i - 1];
+        }
+        graph.EdgeTo = std::vector<int>(numArcs);
+        long long next = 0;
+        auto fill = [&graph, &next](uint64_t key)
+        {
+            graph.EdgeTo[next++] = (int)(uint32_t)key;
+        };
+
+        if (runs.empty())
+        {
+            std::for_each(arcs.begin(), arcs.end(), fill);
+        }
+        else
+        {
+            merged = mergeRuns(runs, arcs.data(), arcs.size(), fill);
+        }
+        closeRuns();
+
+        if (!merged || (next != numArcs))
+        {
+            std::cerr << "ERROR: could not merge the runs of file '" << filename << "'" << std::endl;
+            return false;
+        }
+        graph.m = numArcs / 2;
+    }
+    graph.finishCSR();
+    return true;
+}
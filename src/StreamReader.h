@@ -0,0 +1,70 @@
+/**@file StreamReader.h
+ *
+ * @brief Reader of edge lists with bounded memory, which may be compressed.
+ *
+ * @details The file has the format of the "-e" type (@see Graph::Graph) and
+ * is read sequentially (@see InputStream), so it can be compressed. The graph
+ * is the same as the one of the other edge list readers: loops and duplicated
+ * edges are dropped and the vertices are renamed in order of first appearance.
+ * The memory used besides the CSR arrays is bounded by a budget:
+ *
+ * - If the 2m endpoints of the edges fit in the budget, the file is read
+ *   twice. The first pass counts the occurrences of every vertex and the
+ *   second one fills the rows of the CSR, which are then sorted and
+ *   deduplicated (@see Graph::compactRows).
+ * - Otherwise, the file is read once and the arcs (u, v) and (v, u) of every
+ *   edge are collected in a buffer of the size of the budget (at least
+ *   StreamReader::minRunArcs arcs). Every time it is full, the buffer is
+ *   sorted, deduplicated and written to a temporary file (a run). Whenever
+ *   StreamReader::maxFanIn runs have been merged the same number of times,
+ *   they are merged into a single run, so the files open at the same time
+ *   only grow with the logarithm of the number of runs. Once the file has
+ *   been read, the last runs are merged until at most maxFanIn remain. These
+ *   are then merged twice, dropping the duplicates: the first merge counts the
+ *   degrees and the second one fills EdgeTo, which is allocated with its exact
+ *   size.
+ *
+ * Every merge splits the buffer into the blocks read from its runs (and the
+ * one written to its output), so in both cases the memory peaks near the size
+ * of EdgeTo and EdgesBegin plus the budget, no matter how many duplicated
+ * edges the file has.
+ *
+ * @author Jose L. Walteros
+ *
+ * @version   1.0
+ * @date      June 2018
+ *
+ * Copyright (C) 2018 Jose L. Walteros. All rights reserved.
+ *
+ *---+----+----+----+----+----+----+----+----+----+----+----+----+----+----+----*/
+#ifndef _STREAMREADER_H_
+#define _STREAMREADER_H_
+
+#include "Graph.h"
+
+class StreamReader
+{
+public:
+    static const size_t minRunArcs = 1 << 17; /**< Smallest buffer of arcs,
+    * whatever the budget */
+    static const int maxFanIn = 16; /**< Largest number of runs merged at a
+    * time */
+
+    /**
+     * Reads an edge list into the graph.
+     *
+     * @param[out] graph : The graph.
+     * @param[in] filename : Name of the file.
+     * @param[in] budget : Bytes that the reader can use besides the CSR arrays
+     * and the names of the vertices.
+     * @param[in] numThreads : Number of threads used to sort the rows.
+     *
+     * @returns true if the file was read.
+     */
+    static bool read(
+        Graph &graph,
+        const char *filename,
+        long long budget,
+        int numThreads);
+};
+#endif // _STREAMREADER_H_
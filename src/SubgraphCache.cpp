@@ -0,0 +1,153 @@
+/**@file SubgraphCache.cpp
+ *
+ * @brief Bounded cache of the complement subgraphs tested by the clique search.
+ *
+ * @details The subgraphs are generated outside of the lock, so the workers can
+ * build theirs at the same time.
+ *
+ * @author Jose L. Walteros
+ *
+ * @version   1.0
+ * @date      June 2018
+ *
+ * Copyright (C) 2018 Jose L. Walteros. All rights reserved.
+ *
+ *---+----+----+----+----+----+----+----+----+----+----+----+----+----+----+----*/
+#include <algorithm>
+#include <vector>
+#include "SubgraphCache.h"
+
+std::shared_ptr<subgraph> SubgraphCache::get(
+    int v)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        std::unordered_map<int, std::shared_ptr<subgraph> >::iterator entry = entries.find(v);
+
+        if (entry != entries.end())
+        {
+            numReused++;
+            return entry->second;
+        }
+    }
+
+    std::shared_ptr<subgraph> sG = std::make_shared<subgraph>();
+    graph.generateCompGraphRightNeighbors(v, *sG, bitsets);
+    size_t size = sizeOf(*sG);
+
+    std::lock_guard<std::mutex> lock(mutex);
+    numBuilt++;
+
+    /**
+     * The subgraph is only admitted if it fits in the budget.
+     */
+    if ((bytes + size <= budget) && entries.emplace(v, sG).second)
+    {
+        bytes += size;
+        peakBytes = std::max(peakBytes, bytes);
+    }
+    return sG;
+}
+
+bool SubgraphCache::getMatching(
+    int v,
+    std::vector<int> &mate)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    std::unordered_map<int, std::vector<int> >::iterator entry = matchings.find(v);
+
+    if (entry == matchings.end())
+    {
+        return false;
+    }
+    mate = entry->second;
+    return true;
+}
+
+void SubgraphCache::putMatching(
+    int v,
+    std::vector<int> &mate)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    if (entries.count(v) == 0)
+    {
+        return;
+    }
+    std::vector<int> &entry = matchings[v];
+    bytes = bytes - entry.capacity() * sizeof(int) + mate.capacity() * sizeof(int);
+    peakBytes = std::max(peakBytes, bytes);
+    entry.swap(mate);
+    mate.clear();
+}
+
+void SubgraphCache::prune(
+    int cliqueLB)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    for (std::unordered_map<int, std::shared_ptr<subgraph> >::iterator entry = entries.begin(); entry != entries.end();)
+    {
+        if (entry->second->n <= cliqueLB)
+        {
+            std::unordered_map<int, std::vector<int> >::iterator matching = matchings.find(entry->first);
+
+            if (matching != matchings.end())
+            {
+                bytes -= matching->second.capacity() * sizeof(int);
+                matchings.erase(matching);
+            }
+            bytes -= sizeOf(*entry->second);
+            entry = entries.erase(entry);
+        }
+        else
+        {
+            entry++;
+        }
+    }
+}
+
+void SubgraphCache::invalidate(
+    int v)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    std::unordered_map<int, std::vector<int> >::iterator matching = matchings.find(v);
+
+    if (matching != matchings.end())
+    {
+        bytes -= matching->second.capacity() * sizeof(int);
+        matchings.erase(matching);
+    }
+    std::unordered_map<int, std::shared_ptr<subgraph> >::iterator entry = entries.find(v);
+
+    if (entry != entries.end())
+    {
+        bytes -= sizeOf(*entry->second);
+        entries.erase(entry);
+    }
+}
+
+void SubgraphCache::clear()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    std::unordered_map<int, std::shared_ptr<subgraph> >().swap(entries);
+    std::unordered_map<int, std::vector<int> >().swap(matchings);
+    bytes = 0;
+    peakBytes = 0;
+    numBuilt = 0;
+    numReused = 0;
+}
+
+size_t SubgraphCache::sizeOf(
+    const subgraph &sG)
+{
+    size_t size = sizeof(subgraph) + sG.vertices.capacity() * sizeof(vertex) +
+                  sG.adjLists.capacity() * sizeof(std::vector<int>) +
+                  sG.rows.capacity() * sizeof(uint64_t);
+
+    for (const std::vector<int> &list : sG.adjLists)
+    {
+        size += list.capacity() * sizeof(int);
+    }
+    return size;
+}
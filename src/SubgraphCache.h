@@ -0,0 +1,119 @@
+/**@file SubgraphCache.h
+ *
+ * @brief Bounded cache of the complement subgraphs tested by the clique search.
+ *
+ * @details The complement graph of the closed right neighborhood of a vertex
+ * (@see Graph::generateCompGraphRightNeighbors) is only generated when the
+ * vertex is processed for the first time, so the subgraphs of the vertices
+ * whose right degree is too small for the clique sizes tested are never built.
+ * The generated subgraphs are kept, up to a budget of bytes, so the following
+ * clique sizes can reuse them.
+ *
+ * Every clique size visits the subgraphs in the same order (the sorted list),
+ * a cyclic pattern for which evicting the least recently used entries would
+ * always evict the ones needed next. Instead, a subgraph is only admitted if
+ * it fits in the budget, so the prefix of the sorted list stays cached and the
+ * rest is regenerated, used and discarded. The only entries evicted are those
+ * that cannot be needed anymore: once a clique of size LB has been found, the
+ * subgraphs with at most LB vertices are dropped (@see SubgraphCache::prune).
+ *
+ * The subgraphs are handed out as shared pointers, so an entry that is pruned
+ * while a worker uses it stays alive until the worker is done.
+ *
+ * Together with a subgraph, the cache keeps the maximum matching found by the
+ * last NT kernel of the subgraph, from which the kernel of the next clique size
+ * starts (@see NemhauserTrotter::warmStart).
+ *
+ * @author Jose L. Walteros
+ *
+ * @version   1.0
+ * @date      June 2018
+ *
+ * Copyright (C) 2018 Jose L. Walteros. All rights reserved.
+ *
+ *---+----+----+----+----+----+----+----+----+----+----+----+----+----+----+----*/
+#ifndef _SUBGRAPHCACHE_H_
+#define _SUBGRAPHCACHE_H_
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include "Graph.h"
+
+class SubgraphCache
+{
+public:
+    static const size_t defaultBudget = (size_t)1024 << 20; /**< Default budget (1 GB) */
+
+    Graph &graph; /**< Graph */
+    bool bitsets = false; /**< Whether the subgraphs are generated with bitset rows */
+    size_t budget = defaultBudget; /**< Maximum number of bytes kept in the cache */
+    size_t bytes = 0; /**< Bytes of the subgraphs in the cache */
+    size_t peakBytes = 0; /**< Largest value of bytes */
+    long long numBuilt = 0; /**< Number of subgraphs generated */
+    long long numReused = 0; /**< Number of subgraphs taken from the cache */
+    std::unordered_map<int, std::shared_ptr<subgraph> > entries; /**< Cached subgraphs */
+    std::unordered_map<int, std::vector<int> > matchings; /**< Matching of the
+    * cached subgraphs, indexed by their vertices */
+    std::mutex mutex; /**< Protects the members above */
+
+    /**
+     * SubgraphCache constructor.
+     *
+     * @param[in] graph : The graph. Its ordering must have been computed and
+     * its right neighbors moved to the front (@see Graph::rightNeighborsFirst)
+     * before the first call to SubgraphCache::get.
+     */
+    inline SubgraphCache(
+        Graph &graph) : graph(graph) {}
+
+    /**
+     * Returns the subgraph of v, generating it if it is not in the cache.
+     */
+    std::shared_ptr<subgraph> get(
+        int v);
+
+    /**
+     * Copies the matching stored for the subgraph of v.
+     *
+     * @returns false if there is none.
+     */
+    bool getMatching(
+        int v,
+        std::vector<int> &mate);
+
+    /**
+     * Stores the matching of the subgraph of v (mate is left empty), provided
+     * the subgraph is in the cache.
+     */
+    void putMatching(
+        int v,
+        std::vector<int> &mate);
+
+    /**
+     * Drops the subgraphs with at most cliqueLB vertices, which cannot have a
+     * clique larger than cliqueLB.
+     */
+    void prune(
+        int cliqueLB);
+
+    /**
+     * Drops the subgraph of v and its matching, which are stale once the edges
+     * of its closed right neighborhood change.
+     */
+    void invalidate(
+        int v);
+
+    /**
+     * Drops every subgraph and resets the counters.
+     */
+    void clear();
+
+    /**
+     * Approximate number of bytes used by sG.
+     */
+    static size_t sizeOf(
+        const subgraph &sG);
+};
+#endif // _SUBGRAPHCACHE_H_
@@ -0,0 +1,194 @@
+/**@file ThreadPool.cpp
+ *
+ * @brief Pool of long-lived worker threads.
+ *
+ * @details Every job is identified by a generation number. The workers sleep
+ * until the generation changes, run the job and decrease the number of pending
+ * workers; the last one wakes up the thread that started the job.
+ *
+ * @author Jose L. Walteros
+ *
+ * @version   1.0
+ * @date      June 2018
+ *
+ * Copyright (C) 2018 Jose L. Walteros. All rights reserved.
+ *
+ *---+----+----+----+----+----+----+----+----+----+----+----+----+----+----+----*/
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <sstream>
+#include <string>
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+#include "ThreadPool.h"
+
+ThreadPool::ThreadPool(
+    int numThreads) : numThreads(std::max(numThreads, 1)), job(nullptr), generation(0), pending(0),
+    shutdown(false)
+{
+    for (int t = 1; t < this->numThreads; t++)
+    {
+        threads.push_back(std::thread(&ThreadPool::workerLoop, this, t));
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        shutdown = true;
+    }
+    started.notify_all();
+
+    for (std::thread &th : threads)
+    {
+        th.join();
+    }
+}
+
+void ThreadPool::run(
+    const std::function<void(int)> &job)
+{
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        this->job = &job;
+        pending = numThreads - 1;
+        generation++;
+    }
+    started.notify_all();
+
+    job(0);
+
+    std::unique_lock<std::mutex> guard(lock);
+    finished.wait(guard, [this] { return pending == 0; });
+    this->job = nullptr;
+}
+
+void ThreadPool::workerLoop(
+    int worker)
+{
+    unsigned long seen = 0;
+
+    while (true)
+    {
+        const std::function<void(int)> *current;
+
+        {
+            std::unique_lock<std::mutex> guard(lock);
+            started.wait(guard, [this, seen] { return shutdown || (generation != seen); });
+
+            if (shutdown)
+            {
+                return;
+            }
+            seen = generation;
+            current = job;
+        }
+
+        (*current)(worker);
+
+        std::lock_guard<std::mutex> guard(lock);
+
+        if (--pending == 0)
+        {
+            finished.notify_one();
+        }
+    }
+}
+
+bool ThreadPool::pin()
+{
+#ifdef __linux__
+    std::vector<int> cpus = processors();
+
+    if (cpus.empty())
+    {
+        return false;
+    }
+    std::atomic<bool> pinned(true);
+
+    run([&cpus, &pinned](int t)
+    {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(cpus[t % cpus.size()], &set);
+
+        if (pthread_setaffinity_np(pthread_self(), sizeof(set), &set) != 0)
+        {
+            pinned = false;
+        }
+    });
+    return pinned;
+#else
+    return false;
+#endif
+}
+
+std::vector<int> ThreadPool::processors()
+{
+    std::vector<int> cpus;
+#ifdef __linux__
+    cpu_set_t allowed;
+
+    if (sched_getaffinity(0, sizeof(allowed), &allowed) != 0)
+    {
+        return cpus;
+    }
+    std::vector<bool> taken(CPU_SETSIZE, false);
+
+    /**
+     * Every node lists its processors as ranges, e.g. 0-7,16-23.
+     */
+    for (int node = 0; ; node++)
+    {
+        std::ifstream file("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist");
+        std::string list;
+
+        if (!std::getline(file, list))
+        {
+            break;
+        }
+        std::stringstream ranges(list);
+        std::string range;
+
+        while (std::getline(ranges, range, ','))
+        {
+            int first = -1;
+            int last = -1;
+            char dash;
+            std::stringstream bounds(range);
+
+            if (!(bounds >> first))
+            {
+                continue;
+            }
+
+            if (!(bounds >> dash >> last))
+            {
+                last = first;
+            }
+
+            for (int cpu = std::max(first, 0); (cpu <= last) && (cpu < CPU_SETSIZE); cpu++)
+            {
+                if (CPU_ISSET(cpu, &allowed) && !taken[cpu])
+                {
+                    taken[cpu] = true;
+                    cpus.push_back(cpu);
+                }
+            }
+        }
+    }
+
+    for (int cpu = 0; cpu < CPU_SETSIZE; cpu++)
+    {
+        if (CPU_ISSET(cpu, &allowed) && !taken[cpu])
+        {
+            cpus.push_back(cpu);
+        }
+    }
+#endif
+    return cpus;
+}
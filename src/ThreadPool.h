@@ -0,0 +1,105 @@
+/**@file ThreadPool.h
+ *
+ * @brief Pool of long-lived worker threads.
+ *
+ * @details The pool creates its threads once and reuses them for every job,
+ * which avoids creating and joining new threads for every clique size that is
+ * tested. A job is a function that is run by all the workers at the same time
+ * (each one receives its worker number); ThreadPool::run returns once all of
+ * them have finished, which acts as a barrier between consecutive jobs. The
+ * calling thread takes part in every job as worker 0.
+ *
+ * The workers can be pinned to the processors, which are taken NUMA node by
+ * NUMA node (@see ThreadPool::pin). The memory is placed on the node of the
+ * thread that first touches it, so the scratch data that a pinned worker
+ * grows during the search (its arenas, subgraphs and kernels) stays on its
+ * node.
+ *
+ * @author Jose L. Walteros
+ *
+ * @version   1.0
+ * @date      June 2018
+ *
+ * Copyright (C) 2018 Jose L. Walteros. All rights reserved.
+ *
+ *---+----+----+----+----+----+----+----+----+----+----+----+----+----+----+----*/
+#ifndef _THREADPOOL_H_
+#define _THREADPOOL_H_
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class ThreadPool
+{
+public:
+    /**
+     * ThreadPool constructor: starts numThreads - 1 worker threads.
+     *
+     * @param[in] numThreads : Number of workers, including the calling thread.
+     */
+    ThreadPool(
+        int numThreads);
+
+    /**
+     * Stops and joins the worker threads.
+     */
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    /**
+     * Number of workers, including the calling thread.
+     */
+    inline int size() const
+    {
+        return numThreads;
+    }
+
+    /**
+     * Pins every worker t (the calling thread is worker 0) to the processor
+     * t of ThreadPool::processors, modulo their number, so consecutive
+     * workers fill a NUMA node before they use the next one.
+     *
+     * @returns false if the workers could not be pinned (or pinning is not
+     * supported).
+     */
+    bool pin();
+
+    /**
+     * Processors the process can run on, sorted by NUMA node and then by
+     * number (a single node on the systems that do not report them).
+     */
+    static std::vector<int> processors();
+
+    /**
+     * Runs job(t) on every worker t = 0, ..., size() - 1 and waits until all
+     * of them finish.
+     *
+     * @param[in] job : Function to be run by the workers.
+     */
+    void run(
+        const std::function<void(int)> &job);
+
+private:
+    /**
+     * Main loop of the worker threads: waits for a job, runs it and signals
+     * the end of it.
+     */
+    void workerLoop(
+        int worker);
+
+    int numThreads; /**< Number of workers */
+    std::vector<std::thread> threads; /**< Worker threads 1, ..., numThreads - 1 */
+    std::mutex lock; /**< Protects the members below */
+    std::condition_variable started; /**< Signals a new job (or the shutdown) */
+    std::condition_variable finished; /**< Signals the end of the job */
+    const std::function<void(int)> *job; /**< Current job */
+    unsigned long generation; /**< Number of jobs started so far */
+    int pending; /**< Workers that have not finished the current job */
+    bool shutdown; /**< Whether the workers must stop */
+};
+#endif // _THREADPOOL_H_
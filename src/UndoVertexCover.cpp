@@ -0,0 +1,442 @@
+/**@file UndoVertexCover.cpp
+ *
+ * @brief Finds if a graph has a vertex cover of size k by changing a single
+ * copy of the graph in place.
+ *
+ * @details Every node applies the degree rules, branches on the vertex a with
+ * the largest degree (a is in the vertex cover, or N(a) is) and undoes its
+ * changes before returning.
+ *
+ * @author Jose L. Walteros
+ *
+ * @version   1.0
+ * @date      June 2018
+ *
+ * Copyright (C) 2018 Jose L. Walteros. All rights reserved.
+ *
+ *---+----+----+----+----+----+----+----+----+----+----+----+----+----+----+----*/
+#include <vector>
+#include <algorithm>
+#include <iterator>
+#include "UndoVertexCover.h"
+#include "Scheduler.h"
+
+bool UndoVertexCover::kVertexCover(
+    int n,
+    int k,
+    std::vector<vertex> &vertices,
+    std::vector<std::vector<int> > &adjLists)
+{
+    /**
+     * Every folding adds a vertex and decreases k, so there are at most n + k
+     * vertices.
+     */
+    int capacity = n + std::max(k, 0);
+    numVertices = n;
+    numLive = n;
+    numEdges = 0;
+    names = std::vector<int>(capacity);
+    degree = std::vector<int>(capacity);
+    removed = std::vector<char>(capacity, false);
+    this->adjLists = std::vector<std::vector<int> >(capacity);
+    trail.clear();
+
+    for (int i = 0; i < n; i++)
+    {
+        names[i] = vertices[i].v;
+        degree[i] = adjLists[i].size();
+        this->adjLists[i] = adjLists[i];
+        numEdges += degree[i];
+    }
+    numEdges = numEdges / 2;
+    return search(k);
+}
+
+void UndoVertexCover::remove(
+    int v)
+{
+    removed[v] = true;
+    numLive--;
+    numEdges -= degree[v];
+
+    /**
+     * The scan stops once the degree[v] neighbors that are still in the graph
+     * have been found.
+     */
+    int count = degree[v];
+
+    for (std::vector<int>::iterator u = adjLists[v].begin(); count > 0; u++)
+    {
+        if (!removed[*u])
+        {
+            degree[*u]--;
+            count--;
+        }
+    }
+    trail.push_back(v);
+}
+
+void UndoVertexCover::fold(
+    int v,
+    int a,
+    int b)
+{
+    remove(v);
+    remove(a);
+    remove(b);
+
+    int z = numVertices++;
+    std::vector<int> &row = adjLists[z];
+    row.clear();
+    std::set_union(adjLists[a].begin(), adjLists[a].end(), adjLists[b].begin(), adjLists[b].end(), std::back_inserter(row));
+    row.erase(std::remove_if(row.begin(), row.end(), [this](int u) { return removed[u]; }), row.end());
+
+    for (int u : row)
+    {
+        adjLists[u].push_back(z);
+        degree[u]++;
+    }
+    names[z] = names[v];
+    degree[z] = row.size();
+    removed[z] = false;
+    numLive++;
+    numEdges += degree[z];
+    trail.push_back(-1 - z);
+}
+
+void UndoVertexCover::rollback(
+    size_t size)
+{
+    while (trail.size() > size)
+    {
+        int change = trail.back();
+        trail.pop_back();
+
+        if (change < 0)
+        {
+            /**
+             * Undoes the folding that created z, the last vertex.
+             */
+            int z = -1 - change;
+
+            for (int u : adjLists[z])
+            {
+                adjLists[u].pop_back();
+                degree[u]--;
+            }
+            numEdges -= degree[z];
+            numLive--;
+            numVertices--;
+            continue;
+        }
+
+        int count = degree[change];
+
+        for (std::vector<int>::iterator u = adjLists[change].begin(); count > 0; u++)
+        {
+            if (!removed[*u])
+            {
+                degree[*u]++;
+                count--;
+            }
+        }
+        removed[change] = false;
+        numLive++;
+        numEdges += degree[change];
+    }
+}
+
+int UndoVertexCover::degreePreprocessing(
+    int &k)
+{
+    int initialK = k;
+    bool change = true;
+
+    while (change && numLive > k && k >= 0)
+    {
+        change = false;
+
+        /**
+         * The vertices created by the foldings of this pass are visited as
+         * well.
+         */
+        for (int i = 0; i < numVertices; i++)
+        {
+            if (VC.cancelled())
+            {
+                return -1;
+            }
+
+            if (removed[i])
+            {
+                continue;
+            }
+
+            /**
+             * If i has degree > k, it is in the vertex cover.
+             */
+            if (degree[i] > k)
+            {
+                VC.take(names[i]);
+                remove(i);
+                k--;
+                change = true;
+                continue;
+            }
+
+            /**
+             * If i has degree 1 or 0, it is removed and its neighbor is in
+             * the vertex cover.
+             */
+            if (degree[i] <= 1)
+            {
+                if (degree[i] == 1)
+                {
+                    int u = *std::find_if(adjLists[i].begin(), adjLists[i].end(), [this](int u) { return !removed[u]; });
+                    VC.take(names[u]);
+                    remove(u);
+                    k--;
+                    change = true;
+                }
+                remove(i);
+                continue;
+            }
+
+            if (degree[i] == 2)
+            {
+                std::vector<int>::iterator neighbor = std::find_if(adjLists[i].begin(), adjLists[i].end(), [this](int u) { return !removed[u]; });
+                int a = *neighbor;
+                int b = *std::find_if(neighbor + 1, adjLists[i].end(), [this](int u) { return !removed[u]; });
+                change = true;
+
+                /**
+                 * If the neighbors are adjacent, both are in the vertex cover.
+                 */
+                bool adjacent = (degree[a] <= degree[b]) ?
+                                std::binary_search(adjLists[a].begin(), adjLists[a].end(), b) :
+                                std::binary_search(adjLists[b].begin(), adjLists[b].end(), a);
+
+                if (adjacent)
+                {
+                    VC.take(names[a]);
+                    VC.take(names[b]);
+                    remove(a);
+                    remove(b);
+                    remove(i);
+                    k -= 2;
+                    continue;
+                }
+                VC.recordFold(names[i], names[a], names[b]);
+                fold(i, a, b);
+                k--;
+            }
+        }
+    }
+
+    if (numLive <= k)
+    {
+        /**
+         * The vertices that are left form a vertex cover.
+         */
+        std::vector<int> remaining;
+
+        for (int i = 0; i < numVertices; i++)
+        {
+            if (!removed[i])
+            {
+                remaining.push_back(names[i]);
+            }
+        }
+        VC.coverFound(remaining);
+        return 1;
+    }
+
+    if (k <= 0)
+    {
+        return -1;
+    }
+
+    /**
+     * If the number of edges is larger than k * newK, there is no vertex
+     * cover.
+     */
+    if (numEdges > initialK * k)
+    {
+        return -1;
+    }
+    return 0;
+}
+
+bool UndoVertexCover::search(
+    int k)
+{
+    VC.countNode();
+
+    if (VC.cancelled())
+    {
+        return false;
+    }
+
+    size_t mark = trail.size();
+    size_t stepsMark = VC.steps.size();
+    int success = degreePreprocessing(k);
+
+    if ((success == 0) && VC.isSmall(numLive, k))
+    {
+        /**
+         * The vertices that have not been removed are renumbered from 0.
+         */
+        std::vector<int> liveNames;
+        std::vector<int> position(numVertices, -1);
+
+        for (int i = 0; i < numVertices; i++)
+        {
+            if (!removed[i])
+            {
+                position[i] = liveNames.size();
+                liveNames.push_back(names[i]);
+            }
+        }
+        success = VC.solveSmall(numLive, k, liveNames.data(), [&](uint64_t *rows, int words)
+        {
+            for (int i = 0; i < numVertices; i++)
+            {
+                if (removed[i])
+                {
+                    continue;
+                }
+
+                for (int u : adjLists[i])
+                {
+                    if (!removed[u])
+                    {
+                        rows[position[i] * words + (position[u] >> 6)] |= uint64_t(1) << (position[u] & 63);
+                    }
+                }
+            }
+        }) ? 1 : -1;
+    }
+
+    if (success != 0)
+    {
+        rollback(mark);
+
+        if (success == -1)
+        {
+            VC.steps.resize(stepsMark);
+        }
+        return success == 1;
+    }
+
+    /**
+     * Selects the vertex with the largest degree.
+     */
+    int a = -1;
+    int degreeA = 0;
+
+    for (int i = 0; i < numVertices; i++)
+    {
+        if (!removed[i] && (degree[i] > degreeA))
+        {
+            a = i;
+            degreeA = degree[i];
+        }
+    }
+
+    size_t branchMark = trail.size();
+    size_t branchStepsMark = VC.steps.size();
+    bool published = false;
+
+    /**
+     * If there are idle workers, the lower branch is published as a task and
+     * this thread only explores the upper branch.
+     */
+    if ((VC.scheduler != nullptr) && (numLive >= Scheduler::minTaskSize) && VC.scheduler->needsTasks())
+    {
+        removeNeighborhood(a);
+        publish(k - degreeA);
+        rollback(branchMark);
+        VC.steps.resize(branchStepsMark);
+        published = true;
+    }
+
+    /**
+     * Upper branch: a is in the vertex cover.
+     */
+    VC.take(names[a]);
+    remove(a);
+    bool found = search(k - 1);
+    rollback(branchMark);
+
+    if (!found && !published)
+    {
+        /**
+         * Lower branch: N(a) is in the vertex cover.
+         */
+        VC.steps.resize(branchStepsMark);
+        removeNeighborhood(a);
+        found = search(k - degreeA);
+    }
+    rollback(mark);
+
+    if (!found)
+    {
+        VC.steps.resize(stepsMark);
+    }
+    return found;
+}
+
+void UndoVertexCover::removeNeighborhood(
+    int a)
+{
+    for (int u : adjLists[a])
+    {
+        if (!removed[u])
+        {
+            VC.take(names[u]);
+            remove(u);
+        }
+    }
+    remove(a);
+}
+
+void UndoVertexCover::publish(
+    int k)
+{
+    vcTask task;
+    task.n = numLive;
+    task.k = k;
+    task.root = VC.root;
+    task.steps = VC.steps;
+    task.vertices = std::vector<vertex>(numLive);
+    task.adjLists = std::vector<std::vector<int> >(numLive);
+    std::vector<int> mask(numVertices);
+    int count = 0;
+
+    for (int i = 0; i < numVertices; i++)
+    {
+        if (!removed[i])
+        {
+            task.vertices[count].v = names[i];
+            task.vertices[count].degree = degree[i];
+            task.vertices[count].pos = count;
+            mask[i] = count++;
+        }
+    }
+
+    for (int i = 0; i < numVertices; i++)
+    {
+        if (!removed[i])
+        {
+            for (int u : adjLists[i])
+            {
+                if (!removed[u])
+                {
+                    task.adjLists[mask[i]].push_back(mask[u]);
+                }
+            }
+        }
+    }
+    VC.numPublished++;
+    VC.scheduler->push(VC.worker, std::move(task));
+}
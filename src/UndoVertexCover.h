@@ -0,0 +1,125 @@
+/**@file UndoVertexCover.h
+ *
+ * @brief Finds if a graph has a vertex cover of size k by changing a single
+ * copy of the graph in place.
+ *
+ * @details This is the in-place version of @see VertexCover::kVertexCover. The
+ * nodes of the recursion do not build the graphs of their branches. Instead,
+ * they mark vertices as removed, decrease the degrees of their neighbors and
+ * record every change on an undo trail, which is rolled back when the node
+ * returns. The degree rules and the branching on the vertex with the largest
+ * degree are the ones of the copy based recursion (without its optional rules
+ * and its lower bound).
+ *
+ * A vertex folding of v (with neighbors a and b) removes v, a and b and adds a
+ * new vertex z adjacent to N(a) U N(b) \ {v}. Since z is the last vertex of
+ * the graph, appending z to the adjacency lists of its neighbors keeps them
+ * sorted, and undoing the folding pops it again.
+ *
+ * The recursion shares the cancellation token, the scheduler and the counters
+ * of the VertexCover object of its worker. The branches published for the
+ * other workers are copied to adjacency lists.
+ *
+ * @author Jose L. Walteros
+ *
+ * @version   1.0
+ * @date      June 2018
+ *
+ * Copyright (C) 2018 Jose L. Walteros. All rights reserved.
+ *
+ *---+----+----+----+----+----+----+----+----+----+----+----+----+----+----+----*/
+#ifndef _UNDOVERTEXCOVER_H_
+#define _UNDOVERTEXCOVER_H_
+
+#include <vector>
+#include "Graph.h"
+#include "VertexCover.h"
+
+class UndoVertexCover
+{
+public:
+    VertexCover &VC; /**< Solver of the worker (token, scheduler and counters) */
+    int numVertices; /**< Vertices in the graph, including the removed ones */
+    int numLive; /**< Vertices that have not been removed */
+    int numEdges; /**< Edges between the vertices that have not been removed */
+    std::vector<int> names; /**< Name of the vertices */
+    std::vector<int> degree; /**< Number of neighbors that have not been removed */
+    std::vector<char> removed; /**< Whether the vertices have been removed */
+    std::vector<std::vector<int> > adjLists; /**< Adjacency lists (sorted) */
+    std::vector<int> trail; /**< Changes to undo: v >= 0 for the removal of v and
+    * -1 - z for the folding that created z */
+
+    /**
+     * UndoVertexCover constructor.
+     *
+     * @param[in] VC : Solver of the worker that runs the recursion.
+     */
+    inline UndoVertexCover(
+        VertexCover &VC) : VC(VC), numVertices(0), numLive(0), numEdges(0) {}
+
+    /**
+     * Finds if a graph has a vertex cover of size k.
+     *
+     * @param[in] n : Number of vertices in the graph.
+     * @param[in] k : Expected size of the vertex cover.
+     * @param[in] vertices : vertices of the graph.
+     * @param[in] adjLists : Adjacency lists of the graphs.
+     */
+    bool kVertexCover(
+        int n,
+        int k,
+        std::vector<vertex> &vertices,
+        std::vector<std::vector<int> > &adjLists);
+
+    /**
+     * Node of the recursion. The graph is restored before returning.
+     */
+    bool search(
+        int k);
+
+    /**
+     * Applies the degree rules of VertexCover::degreePreprocessing until there
+     * is no further update.
+     *
+     * @param[in,out] k : Expected size of the vertex cover.
+     *
+     * @returns 1 if there is a vertex cover, -1 if there is none and 0 if the
+     * node must branch.
+     */
+    int degreePreprocessing(
+        int &k);
+
+    /**
+     * Removes v and decreases the degrees of its neighbors.
+     */
+    void remove(
+        int v);
+
+    /**
+     * Folds the vertex v of degree 2 with neighbors a and b.
+     */
+    void fold(
+        int v,
+        int a,
+        int b);
+
+    /**
+     * Removes N[a], recording that the neighbors of a are in the vertex cover.
+     */
+    void removeNeighborhood(
+        int a);
+
+    /**
+     * Undoes the changes of the trail until it has the given size.
+     */
+    void rollback(
+        size_t size);
+
+    /**
+     * Publishes the graph induced by the vertices that have not been removed
+     * as a task of the scheduler.
+     */
+    void publish(
+        int k);
+};
+#endif // _UNDOVERTEXCOVER_H_
@@ -0,0 +1,1336 @@
+/**@file VertexCover.cpp
+ *
+ * @brief Finds if a graph has a vertex cover of size k.
+ *
+ * @details The procedure performs the following tasks until there is no further
+ * update:
+ *
+ * 1. Any isolated vertex is removed.
+ * 2. If there is a vertex v with degree 1, both v and its neighbor are removed
+ *    and k is decreased by 1.
+ * 3. If there is a graph v with degree 2:
+ *    a. If its neighbors u and w are adjacent, u, v, and w are removed and k is
+ *    decreased by 2.
+ *    b. If its neighbors u and w are not adjacent, u and w are removed and its
+ *    neighbors are attatched to v (vertex folding). k is decreased by 1.
+ * 4. Optionally, the twin, domination and unconfined rules.
+ *
+ * If a lower bound of the vertex cover is larger than k, there is none.
+ * Otherwise, the vertex v with the largest degree is selected. The procedure
+ * generates one branch in which v (and its mirrors) are assumed to be in the
+ * vertex cover, and a second one in which N(v) (and the neighbors of its
+ * satellites) are in the vertex cover.
+ *
+ * @author Jose L. Walteros
+ *
+ * @version   1.0
+ * @date      January 2018
+ *
+ * Copyright (C) 2018 Jose L. Walteros. All rights reserved.
+ *
+ *---+----+----+----+----+----+----+----+----+----+----+----+----+----+----+----*/
+#include <vector>
+#include <iostream>
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include "VertexCover.h"
+#include "Graph.h"
+
+/**
+ * Replaces old by v in the sorted adjacency list row of size, keeping it
+ * sorted. Used by the vertex folding.
+ */
+static void replaceNeighbor(
+    int *row,
+    int size,
+    int old,
+    int v)
+{
+    int p = std::lower_bound(row, row + size, old) - row;
+    row[p] = v;
+
+    while ((p > 0) && (row[p - 1] > row[p]))
+    {
+        std::swap(row[p - 1], row[p]);
+        p--;
+    }
+
+    while ((p + 1 < size) && (row[p + 1] < row[p]))
+    {
+        std::swap(row[p + 1], row[p]);
+        p++;
+    }
+}
+
+static const char *reductionNames[] = {"high degree", "degree one", "triangle", "fold", "twin", "domination", "unconfined",
+    "mirror", "satellite"};
+
+const char *VertexCover::reductionName(
+    int rule)
+{
+    return reductionNames[rule];
+}
+
+bool VertexCover::parseReductions(
+    const char *names,
+    unsigned &mask)
+{
+    std::string list(names);
+
+    if (list == "none")
+    {
+        mask = 0;
+        return true;
+    }
+
+    if (list == "all")
+    {
+        mask = allReductions;
+        return true;
+    }
+    mask = 0;
+    size_t begin = 0;
+
+    while (begin <= list.size())
+    {
+        size_t end = std::min(list.find(',', begin), list.size());
+        std::string name = list.substr(begin, end - begin);
+        int rule = twinRule;
+
+        while ((rule < numReductions) && (name != reductionNames[rule]))
+        {
+            rule++;
+        }
+
+        if (rule == numReductions)
+        {
+            return false;
+        }
+        mask |= 1u << rule;
+        begin = end + 1;
+    }
+    return true;
+}
+
+int VertexCover::degreePreprocessing(
+    flatGraph &G,
+    int k,
+    int &newK,
+    flatGraph &kernel)
+{
+    int n = G.n;
+    int numRemoved = 0;
+    bool useUnconfined = (reductions & (1u << unconfinedRule)) != 0;
+
+    newK = k;
+
+    /**
+     * degreeDecrease is used to udate the degree of the vertices based on the
+     * neighbors that have been removed or the vertex that have been attached
+     * after a vertex folding. The worklist (a circular queue, with every vertex
+     * at most once in it) holds the vertices whose neighborhood has changed.
+     * The unconfined rule also needs the stamps of S and N[S] and the list of
+     * the vertices of S.
+     */
+    int removedOffset = arena.allocateZeros((useUnconfined ? 7 : 4) * n);
+    int *removed;
+    int *degDecrease;
+    int *queued;
+    int *queue;
+    int *inS;
+    int *inNS;
+    int *setS;
+    int *degrees;
+    int *begins;
+    int *names;
+    int *data;
+
+    /**
+     * The pointers must be obtained again after every allocation.
+     */
+    auto refresh = [&]()
+    {
+        data = arena.at(0);
+        removed = data + removedOffset;
+        degDecrease = removed + n;
+        queued = removed + 2 * n;
+        queue = removed + 3 * n;
+        inS = removed + 4 * n;
+        inNS = removed + 5 * n;
+        setS = removed + 6 * n;
+        degrees = data + G.degrees;
+        begins = data + G.begins;
+        names = data + G.names;
+    };
+    refresh();
+
+    int head = 0;
+    int numQueued = 0;
+    int stamp = 0;
+
+    auto push = [&](int v)
+    {
+        if (!removed[v] && !queued[v])
+        {
+            queued[v] = true;
+            queue[(head + numQueued) % n] = v;
+            numQueued++;
+        }
+    };
+
+    auto degree = [&](int v)
+    {
+        return degrees[v] - degDecrease[v];
+    };
+
+    auto adjacent = [&](int u, int v)
+    {
+        return !removed[v] && std::binary_search(data + begins[u], data + begins[u] + degrees[u], v);
+    };
+
+    /**
+     * Removes v, decreasing the degree of its neighbors, which go to the
+     * worklist.
+     */
+    auto drop = [&](int v)
+    {
+        removed[v] = true;
+        numRemoved++;
+
+        for (int *current = data + begins[v]; current != data + begins[v] + degrees[v]; current++)
+        {
+            if (!removed[*current])
+            {
+                degDecrease[*current]++;
+                push(*current);
+            }
+        }
+    };
+
+    /**
+     * Puts v in the vertex cover.
+     */
+    auto cover = [&](int v)
+    {
+        take(names[v]);
+        newK--;
+        drop(v);
+    };
+
+    for (int i = 0; i < n; i++)
+    {
+        push(i);
+    }
+
+    /**
+     * Value of k for which the vertices of degree > k have been looked for
+     * in the whole graph (the worklist only sees the vertices whose degree
+     * changed).
+     */
+    int checkedK = newK;
+
+    while (n - numRemoved > newK && newK >= 0)
+    {
+        if (numQueued == 0)
+        {
+            if (checkedK == newK)
+            {
+                break;
+            }
+            checkedK = newK;
+
+            for (int i = 0; i < n; i++)
+            {
+                if (!removed[i] && (degree(i) > newK))
+                {
+                    push(i);
+                }
+            }
+            continue;
+        }
+
+        if (cancelled())
+        {
+            return -1;
+        }
+        int i = queue[head];
+        head = (head + 1) % n;
+        numQueued--;
+        queued[i] = false;
+
+        if (removed[i])
+        {
+            continue;
+        }
+        int d = degree(i);
+
+        /**
+         * If i has degree > new K.
+         */
+        if (d > newK)
+        {
+            numReduced[highDegreeRule]++;
+            cover(i);
+            continue;
+        }
+
+        /**
+         * If i has degree 1 or 0.
+         */
+        if (d <= 1)
+        {
+            drop(i);
+
+            /**
+             * If i has degree 1, find its neighbor and put it in the cover.
+             */
+            if (d == 1)
+            {
+                int *neighbor = data + begins[i];
+
+                while (removed[*neighbor])
+                {
+                    neighbor++;
+                }
+                numReduced[degreeOneRule]++;
+                cover(*neighbor);
+            }
+            continue;
+        }
+
+        /**
+         * If i has degree 2.
+         */
+        if (d == 2)
+        {
+            /**
+             * Finds the neigbors.
+             */
+            int *neighbor = data + begins[i];
+
+            while (removed[*neighbor])
+            {
+                neighbor++;
+            }
+            int a = *neighbor++;
+
+            while (removed[*neighbor])
+            {
+                neighbor++;
+            }
+            int b = *neighbor;
+
+            /**
+             * If the neighbors are adjacent, the three vertices are removed.
+             */
+            if ((degree(a) <= degree(b)) ? adjacent(a, b) : adjacent(b, a))
+            {
+                numReduced[triangleRule]++;
+                cover(a);
+                cover(b);
+                drop(i);
+                continue;
+            }
+
+            /**
+             * If the neighbors are not adjacent, performs a vertex folding.
+             * The new list of i is the union of N(a) and N(b), and its
+             * neighbors replace a or b by i in their lists (if a vertex is
+             * adjacent to both, the other entry is left as removed).
+             */
+            numReduced[foldRule]++;
+            removed[a] = true;
+            removed[b] = true;
+            newK = newK - 1;
+            numRemoved = numRemoved + 2;
+            recordFold(names[i], names[a], names[b]);
+            int rowOffset = arena.allocate(degrees[a] + degrees[b]);
+            refresh();
+            int *row = data + rowOffset;
+            int size = 0;
+            int *current1 = data + begins[a];
+            int *current2 = data + begins[b];
+            int *end1 = current1 + degrees[a];
+            int *end2 = current2 + degrees[b];
+
+            while (current1 != end1 && current2 != end2)
+            {
+                if (removed[*current1] || (*current1 == i))
+                {
+                    current1++;
+                    continue;
+                }
+
+                if (removed[*current2] || (*current2 == i))
+                {
+                    current2++;
+                    continue;
+                }
+
+                if (*current1 < *current2)
+                {
+                    replaceNeighbor(data + begins[*current1], degrees[*current1], a, i);
+                    row[size++] = *current1;
+                    current1++;
+                    continue;
+                }
+
+                if (*current2 < *current1)
+                {
+                    replaceNeighbor(data + begins[*current2], degrees[*current2], b, i);
+                    row[size++] = *current2;
+                    current2++;
+                    continue;
+                }
+
+                // Same vertex
+                replaceNeighbor(data + begins[*current1], degrees[*current1], a, i);
+                row[size++] = *current1;
+                degDecrease[*current1]++;
+                current1++;
+                current2++;
+            }
+
+            for (; current1 != end1; current1++)
+            {
+                if (!removed[*current1] && (*current1 != i))
+                {
+                    replaceNeighbor(data + begins[*current1], degrees[*current1], a, i);
+                    row[size++] = *current1;
+                }
+            }
+
+            for (; current2 != end2; current2++)
+            {
+                if (!removed[*current2] && (*current2 != i))
+                {
+                    replaceNeighbor(data + begins[*current2], degrees[*current2], b, i);
+                    row[size++] = *current2;
+                }
+            }
+            begins[i] = rowOffset;
+            degrees[i] = size;
+            degDecrease[i] = 0;
+
+            /**
+             * The neighborhoods of i and of its new neighbors have changed.
+             */
+            push(i);
+
+            for (int j = 0; j < size; j++)
+            {
+                push(row[j]);
+            }
+            continue;
+        }
+
+        int *row = data + begins[i];
+        int *end = row + degrees[i];
+
+        /**
+         * Twin rule: if i and another vertex of degree 3 have the same
+         * neighbors and there is an edge between them, the three neighbors
+         * are in the vertex cover.
+         */
+        if ((d == 3) && (reductions & (1u << twinRule)))
+        {
+            int nbrs[3];
+            int numNbrs = 0;
+
+            for (int *current = row; current != end; current++)
+            {
+                if (!removed[*current])
+                {
+                    nbrs[numNbrs++] = *current;
+                }
+            }
+            int a = nbrs[0];
+            int b = nbrs[1];
+            int c = nbrs[2];
+
+            if (adjacent(a, b) || adjacent(a, c) || adjacent(b, c))
+            {
+                bool twin = false;
+
+                for (int *current = data + begins[a]; !twin && (current != data + begins[a] + degrees[a]); current++)
+                {
+                    int v = *current;
+                    twin = (v != i) && !removed[v] && (degree(v) == 3) && adjacent(v, b) && adjacent(v, c);
+                }
+
+                if (twin)
+                {
+                    numReduced[twinRule]++;
+                    cover(a);
+                    cover(b);
+                    cover(c);
+                    continue;
+                }
+            }
+        }
+
+        /**
+         * Domination rule: if N[i] is contained in N[v] for a neighbor v of i,
+         * v is in the vertex cover.
+         */
+        if (reductions & (1u << dominationRule))
+        {
+            int dominating = -1;
+
+            for (int *current = row; (dominating == -1) && (current != end); current++)
+            {
+                int v = *current;
+
+                if (removed[v] || (degree(v) < d))
+                {
+                    continue;
+                }
+                bool contained = true;
+
+                for (int *other = row; contained && (other != end); other++)
+                {
+                    contained = removed[*other] || (*other == v) || adjacent(v, *other);
+                }
+
+                if (contained)
+                {
+                    dominating = v;
+                }
+            }
+
+            if (dominating >= 0)
+            {
+                numReduced[dominationRule]++;
+                cover(dominating);
+                continue;
+            }
+        }
+
+        /**
+         * Unconfined rule (Xiao and Nagamochi (2013)): starting from S = {i},
+         * looks for a neighbor u of S with a single neighbor in S. If u has no
+         * neighbors outside N[S], i is unconfined and it is in the vertex
+         * cover. If it has one, w, S grows with w and the search goes on.
+         */
+        if (useUnconfined)
+        {
+            stamp++;
+            int sizeS = 1;
+            setS[0] = i;
+            inS[i] = stamp;
+            inNS[i] = stamp;
+
+            for (int *current = row; current != end; current++)
+            {
+                inNS[*current] = stamp;
+            }
+            bool unconfined = false;
+
+            while (true)
+            {
+                int bestOut = 2;
+                int bestW = -1;
+
+                for (int j = 0; (j < sizeS) && (bestOut > 0); j++)
+                {
+                    int s = setS[j];
+
+                    for (int *u = data + begins[s]; (u != data + begins[s] + degrees[s]) && (bestOut > 0); u++)
+                    {
+                        if (removed[*u])
+                        {
+                            continue;
+                        }
+                        int numInS = 0;
+                        int numOut = 0;
+                        int w = -1;
+
+                        for (int *x = data + begins[*u]; x != data + begins[*u] + degrees[*u]; x++)
+                        {
+                            if (removed[*x])
+                            {
+                                continue;
+                            }
+
+                            if (inS[*x] == stamp)
+                            {
+                                numInS++;
+                            }
+                            else if (inNS[*x] != stamp)
+                            {
+                                numOut++;
+                                w = *x;
+                            }
+                        }
+
+                        if ((numInS == 1) && (numOut < bestOut))
+                        {
+                            bestOut = numOut;
+                            bestW = w;
+                        }
+                    }
+                }
+
+                if (bestOut == 0)
+                {
+                    unconfined = true;
+                }
+
+                if (bestOut != 1)
+                {
+                    break;
+                }
+                setS[sizeS++] = bestW;
+                inS[bestW] = stamp;
+                inNS[bestW] = stamp;
+
+                for (int *current = data + begins[bestW]; current != data + begins[bestW] + degrees[bestW]; current++)
+                {
+                    inNS[*current] = stamp;
+                }
+            }
+
+            if (unconfined)
+            {
+                numReduced[unconfinedRule]++;
+                cover(i);
+                continue;
+            }
+        }
+    }
+
+    if (n - numRemoved <= newK)
+    {
+        /**
+         * The vertices that are left form a vertex cover.
+         */
+        std::vector<int> remaining;
+
+        for (int i = 0; i < n; i++)
+        {
+            if (!removed[i])
+            {
+                remaining.push_back(names[i]);
+            }
+        }
+        coverFound(remaining);
+        return 1;
+    }
+
+    if (newK <= 0)
+    {
+        return -1;
+    }
+
+    /**
+     * Generates the kernel.
+     */
+    subgraphUpdate(G, removedOffset, kernel);
+
+    /**
+     * If the number of edges in the kernel is less than k*(k-highDegVertices),
+     * returns -1 (there is no VC).
+     */
+    if (kernel.m > k * newK)
+    {
+        return -1;
+    }
+
+    /**
+     * Return 0, as there could be a VC.
+     */
+    return 0;
+}
+
+void VertexCover::subgraphUpdate(
+    int n,
+    int &numRemoved,
+    std::vector<vertex> &vertices,
+    std::vector<std::vector<int> > &adjLists,
+    std::vector<bool> &removed,
+    subgraph &sG)
+{
+    /**
+     *  Position of the vertices in the kernel vector of vertices.
+     */
+    std::vector<int> mask(n);
+
+    /**
+     * The following code populates the vector of vertices in the kernel.
+     */
+    sG.n = n - numRemoved;
+    sG.m = 0;
+    sG.vertices = std::vector<vertex>(n - numRemoved);
+    sG.adjLists = std::vector<std::vector<int> >(n - numRemoved);
+    int count = 0;
+
+    for (int i = 0; i < n; i++)
+    {
+        vertex v = vertices[i];
+
+        if (removed[v.pos] == false)
+        {
+            sG.vertices[count].v = v.v;
+            sG.vertices[count].degree = 0;
+            sG.vertices[count].pos = count;
+            sG.adjLists[count] = std::vector<int>();
+            sG.adjLists[count].reserve(v.degree);
+            mask[v.pos] = count;
+            count++;
+        }
+    }
+
+    /**
+     * The following code populates the adjacency lists of the kernel.
+     */
+    int largestDegree = 0;
+
+    for (int i = 0; i < n; i++)
+    {
+        vertex v = vertices[i];
+
+        if (removed[v.pos] == false)
+        {
+            for (std::vector<int>::iterator current = adjLists[v.pos].begin(); current != adjLists[v.pos].end(); current++)
+            {
+                if (removed[*current] == false)
+                {
+                    sG.adjLists[mask[v.pos]].push_back(mask[*current]);
+                    sG.vertices[mask[v.pos]].degree++;
+                }
+            }
+            sG.m += sG.vertices[mask[v.pos]].degree;
+
+            if (largestDegree < sG.vertices[mask[v.pos]].degree)
+            {
+                largestDegree = sG.vertices[mask[v.pos]].degree;
+                sG.largestDegreeVertex = mask[v.pos];
+            }
+        }
+    }
+    sG.m = sG.m / 2;
+    sG.created = true;
+}
+
+void VertexCover::subgraphUpdate(
+    flatGraph &G,
+    int removed,
+    flatGraph &sG)
+{
+    /**
+     *  Position of the vertices in the kernel vector of vertices.
+     */
+    int maskOffset = arena.allocate(G.n);
+    int *data = arena.at(0);
+    int count = 0;
+
+    for (int i = 0; i < G.n; i++)
+    {
+        if (!data[removed + i])
+        {
+            data[maskOffset + i] = count++;
+        }
+    }
+
+    /**
+     * The following code populates the vector of vertices in the kernel.
+     */
+    sG.n = count;
+    sG.m = 0;
+    sG.names = arena.allocate(3 * count);
+    sG.degrees = sG.names + count;
+    sG.begins = sG.degrees + count;
+    data = arena.at(0);
+    int numEntries = 0;
+
+    for (int i = 0; i < G.n; i++)
+    {
+        if (!data[removed + i])
+        {
+            int degree = 0;
+            int *row = data + data[G.begins + i];
+
+            for (int *current = row; current != row + data[G.degrees + i]; current++)
+            {
+                degree += !data[removed + *current];
+            }
+            int j = data[maskOffset + i];
+            data[sG.names + j] = data[G.names + i];
+            data[sG.degrees + j] = degree;
+            numEntries += degree;
+        }
+    }
+
+    /**
+     * The following code populates the adjacency lists of the kernel.
+     */
+    int rows = arena.allocate(numEntries);
+    data = arena.at(0);
+    int largestDegree = 0;
+
+    for (int i = 0; i < G.n; i++)
+    {
+        if (!data[removed + i])
+        {
+            int j = data[maskOffset + i];
+            int *row = data + data[G.begins + i];
+            data[sG.begins + j] = rows;
+
+            for (int *current = row; current != row + data[G.degrees + i]; current++)
+            {
+                if (!data[removed + *current])
+                {
+                    data[rows++] = data[maskOffset + *current];
+                }
+            }
+
+            if (largestDegree < data[sG.degrees + j])
+            {
+                largestDegree = data[sG.degrees + j];
+                sG.largestDegreeVertex = j;
+            }
+        }
+    }
+    sG.m = numEntries / 2;
+}
+
+bool VertexCover::kVertexCover(
+    int n,
+    int k,
+    std::vector<vertex> &vertices,
+    std::vector<std::vector<int> > &adjLists)
+{
+    int mark = arena.mark();
+
+    /**
+     * Copies the graph to the arena.
+     */
+    int numEntries = 0;
+
+    for (int i = 0; i < n; i++)
+    {
+        numEntries += adjLists[i].size();
+    }
+    flatGraph G;
+    G.n = n;
+    G.m = numEntries / 2;
+    G.names = arena.allocate(3 * n + numEntries);
+    G.degrees = G.names + n;
+    G.begins = G.degrees + n;
+    G.largestDegreeVertex = 0;
+    int *data = arena.at(0);
+    int rows = G.begins + n;
+
+    for (int i = 0; i < n; i++)
+    {
+        data[G.names + i] = vertices[i].v;
+        data[G.degrees + i] = adjLists[i].size();
+        data[G.begins + i] = rows;
+        std::copy(adjLists[i].begin(), adjLists[i].end(), data + rows);
+        rows += adjLists[i].size();
+    }
+
+    depth = 0;
+    bool found = search(G, k);
+    arena.release(mark);
+    return found;
+}
+
+bool VertexCover::search(
+    flatGraph &G,
+    int k)
+{
+    countNode();
+
+    if (cancelled())
+    {
+        return false;
+    }
+
+    /**
+     * The nodes and the time of every depth go to the statistics of the
+     * worker, if they are collected (@see VertexCover::stats). The time of the node does not include the
+     * one of its children.
+     */
+    std::chrono::high_resolution_clock::time_point start;
+
+    if (statsEnabled && (stats != nullptr))
+    {
+        stats->countDepth(depth);
+        start = std::chrono::high_resolution_clock::now();
+    }
+
+    auto pause = [&]()
+    {
+        if (statsEnabled && (stats != nullptr))
+        {
+            stats->depthTime[depth] += std::chrono::duration_cast<std::chrono::duration<double> >(std::chrono::high_resolution_clock::now() - start).count();
+        }
+    };
+
+    auto resume = [&]()
+    {
+        if (statsEnabled && (stats != nullptr))
+        {
+            start = std::chrono::high_resolution_clock::now();
+        }
+    };
+
+    int mark = arena.mark();
+    size_t stepsMark = steps.size();
+    flatGraph sG;
+    int newK = 0;
+    int success = 0;
+
+    if (isSmall(G.n, k))
+    {
+        /**
+         * A small node is solved by SmallVertexCover, which applies its own
+         * degree rules.
+         */
+        int *data = arena.at(0);
+        success = solveSmall(G.n, k, data + G.names, [&](uint64_t *rows, int words)
+        {
+            for (int i = 0; i < G.n; i++)
+            {
+                const int *list = data + data[G.begins + i];
+
+                for (int j = 0; j < data[G.degrees + i]; j++)
+                {
+                    rows[i * words + (list[j] >> 6)] |= uint64_t(1) << (list[j] & 63);
+                }
+            }
+        }) ? 1 : -1;
+    }
+    else
+    {
+        /**
+         * Creates tha kernel based on the procedure that preprocess that
+         * vertices based on their degree (@see
+         * VertexCover::degreePreprocessing).
+         */
+        success = degreePreprocessing(G, k, newK, sG);
+
+        if ((success == 0) && (lowerBound(sG) > newK))
+        {
+            numPruned++;
+            success = -1;
+        }
+    }
+
+    if (success != 0)
+    {
+        arena.release(mark);
+
+        if (success == -1)
+        {
+            steps.resize(stepsMark);
+        }
+        pause();
+        return success == 1;
+    }
+
+    /**
+     * The branches on the vertex with the largest degree (@see
+     * VertexCover::branchSets).
+     */
+    int a = sG.largestDegreeVertex;
+    int upper = arena.allocate(2 * sG.n);
+    int lower = upper + sG.n;
+    int numUpper = 0;
+    int numLowerCover = 0;
+    int numLower = 0;
+    branchSets(sG, a, upper, numUpper, lower, numLowerCover, numLower);
+    int branchMark = arena.mark();
+    size_t branchStepsMark = steps.size();
+    flatGraph branch;
+
+    /**
+     * If there are idle workers, the lower branch is published as a task and
+     * this thread only explores the upper branch.
+     */
+    bool published = false;
+
+    if ((scheduler != nullptr) && (sG.n >= Scheduler::minTaskSize) && scheduler->needsTasks())
+    {
+        takeAll(sG, lower, numLowerCover);
+        branchGraph(sG, lower, numLower, branch);
+        publish(branch, newK - numLowerCover);
+        arena.release(branchMark);
+        steps.resize(branchStepsMark);
+        published = true;
+    }
+
+    /**
+     * Generates the upper branch: Assumes a (and its mirrors) is in the vertex
+     * cover.
+     */
+    takeAll(sG, upper, numUpper);
+    branchGraph(sG, upper, numUpper, branch);
+    pause();
+    depth++;
+    bool found = search(branch, newK - numUpper);
+    depth--;
+    resume();
+    arena.release(branchMark);
+
+    if (!found && !published)
+    {
+        /**
+         * Generates the lower branch: Assumes N(a) (and the neighbors of its
+         * satellites) is in the vertex cover.
+         */
+        steps.resize(branchStepsMark);
+        takeAll(sG, lower, numLowerCover);
+        branchGraph(sG, lower, numLower, branch);
+        pause();
+        depth++;
+        found = search(branch, newK - numLowerCover);
+        depth--;
+        resume();
+    }
+    arena.release(mark);
+
+    if (!found)
+    {
+        steps.resize(stepsMark);
+    }
+    pause();
+    return found;
+}
+
+int VertexCover::lowerBound(
+    flatGraph &G)
+{
+    int n = G.n;
+    int mark = arena.mark();
+    int offset = arena.allocate(4 * n);
+    int *data = arena.at(0);
+    int *cliqueOf = data + offset;
+    int *size = cliqueOf + n;
+    int *seen = size + n;
+    int *count = seen + n;
+    int *degrees = data + G.degrees;
+    int *begins = data + G.begins;
+    int numCliques = 0;
+
+    /**
+     * Every vertex joins the largest clique of the previous vertices that is
+     * contained in its neighborhood, or starts a new one.
+     */
+    for (int v = 0; v < n; v++)
+    {
+        int best = -1;
+
+        for (int *u = data + begins[v]; (u != data + begins[v] + degrees[v]) && (*u < v); u++)
+        {
+            int c = cliqueOf[*u];
+
+            if (seen[c] != v)
+            {
+                seen[c] = v;
+                count[c] = 0;
+            }
+            count[c]++;
+
+            if ((count[c] == size[c]) && ((best == -1) || (size[c] > size[best])))
+            {
+                best = c;
+            }
+        }
+
+        if (best == -1)
+        {
+            best = numCliques++;
+            size[best] = 0;
+            seen[best] = -1;
+        }
+        cliqueOf[v] = best;
+        size[best]++;
+    }
+    arena.release(mark);
+
+    /**
+     * A vertex cover has all the vertices of a clique but one.
+     */
+    return n - numCliques;
+}
+
+void VertexCover::branchSets(
+    flatGraph &G,
+    int a,
+    int upper,
+    int &numUpper,
+    int lower,
+    int &numLowerCover,
+    int &numLower)
+{
+    const int inNeighborhood = 1;
+    const int isA = 2;
+    const int visited = 3;
+    const int isSatellite = 4;
+    const int inLower = 5;
+
+    int n = G.n;
+    int mark = arena.mark();
+    int markOffset = arena.allocateZeros(2 * n);
+    int *data = arena.at(0);
+    int *marks = data + markOffset;
+    int *common = marks + n;
+    int *degrees = data + G.degrees;
+    int *begins = data + G.begins;
+    int *up = data + upper;
+    int *low = data + lower;
+    int *rowA = data + begins[a];
+    int *endA = rowA + degrees[a];
+
+    auto adjacent = [&](int u, int v)
+    {
+        return std::binary_search(data + begins[u], data + begins[u] + degrees[u], v);
+    };
+
+    marks[a] = isA;
+
+    for (int *w = rowA; w != endA; w++)
+    {
+        marks[*w] = inNeighborhood;
+    }
+    numUpper = 0;
+    up[numUpper++] = a;
+
+    /**
+     * Mirrors: the vertices u at distance 2 from a such that N(a) \ N(u) is a
+     * clique. The number of common neighbors of a and u gives the size of
+     * N(a) \ N(u), and only the small sets are checked (the mirrors that are
+     * missed only make the upper branch smaller). The candidates are kept
+     * after a in the array of the upper branch, and the lower one holds the
+     * vertices of N(a) \ N(u) meanwhile.
+     */
+    int numCandidates = 1;
+
+    for (int *w = rowA; (reductions & (1u << mirrorRule)) && (w != endA); w++)
+    {
+        for (int *u = data + begins[*w]; u != data + begins[*w] + degrees[*w]; u++)
+        {
+            if (marks[*u] == 0)
+            {
+                marks[*u] = visited;
+                up[numCandidates++] = *u;
+            }
+
+            if (marks[*u] == visited)
+            {
+                common[*u]++;
+            }
+        }
+    }
+
+    for (int c = 1; c < numCandidates; c++)
+    {
+        int u = up[c];
+        int numMissing = degrees[a] - common[u];
+        bool clique = (numMissing <= maxMirrorCheck);
+
+        if (clique && (numMissing > 1))
+        {
+            numMissing = 0;
+
+            for (int *x = rowA; clique && (x != endA); x++)
+            {
+                if (adjacent(u, *x))
+                {
+                    continue;
+                }
+
+                for (int i = 0; clique && (i < numMissing); i++)
+                {
+                    clique = adjacent(*x, low[i]);
+                }
+                low[numMissing++] = *x;
+            }
+        }
+
+        if (clique)
+        {
+            up[numUpper++] = u;
+        }
+    }
+
+    /**
+     * Without mirrors, the satellites of a are used: the vertices s such that
+     * N(u) \ N[a] = {s} for a neighbor u of a. If a is not in the vertex
+     * cover, there is one without the satellites. Two adjacent satellites
+     * cannot be left out together, so only the first one is used.
+     */
+    numLower = 0;
+
+    for (int *w = rowA; w != endA; w++)
+    {
+        low[numLower++] = *w;
+    }
+    numLowerCover = numLower;
+
+    if ((numUpper == 1) && (reductions & (1u << satelliteRule)))
+    {
+        int numSatellites = 0;
+
+        for (int *w = rowA; w != endA; w++)
+        {
+            int satellite = -1;
+            int numOutside = 0;
+
+            for (int *u = data + begins[*w]; (numOutside < 2) && (u != data + begins[*w] + degrees[*w]); u++)
+            {
+                if ((marks[*u] != inNeighborhood) && (marks[*u] != isA) && (marks[*u] != inLower))
+                {
+                    satellite = *u;
+                    numOutside++;
+                }
+            }
+
+            if ((numOutside != 1) || (marks[satellite] == isSatellite))
+            {
+                continue;
+            }
+            bool independent = true;
+
+            for (int *u = data + begins[satellite]; independent && (u != data + begins[satellite] + degrees[satellite]); u++)
+            {
+                independent = marks[*u] != isSatellite;
+            }
+
+            if (!independent)
+            {
+                continue;
+            }
+            marks[satellite] = isSatellite;
+            numSatellites++;
+        }
+
+        if (numSatellites > 0)
+        {
+            numReduced[satelliteRule]++;
+
+            /**
+             * N(S) \ N(a) joins the cover of the lower branch, and a and S
+             * are removed with it.
+             */
+            for (int v = 0; v < n; v++)
+            {
+                if (marks[v] != isSatellite)
+                {
+                    continue;
+                }
+
+                for (int *u = data + begins[v]; u != data + begins[v] + degrees[v]; u++)
+                {
+                    if ((marks[*u] != inNeighborhood) && (marks[*u] != inLower))
+                    {
+                        marks[*u] = inLower;
+                        low[numLower++] = *u;
+                    }
+                }
+            }
+            numLowerCover = numLower;
+
+            for (int v = 0; v < n; v++)
+            {
+                if (marks[v] == isSatellite)
+                {
+                    low[numLower++] = v;
+                }
+            }
+        }
+    }
+    else if (numUpper > 1)
+    {
+        numReduced[mirrorRule]++;
+    }
+    low[numLower++] = a;
+    arena.release(mark);
+}
+
+void VertexCover::branchGraph(
+    flatGraph &sG,
+    int list,
+    int size,
+    flatGraph &branch)
+{
+    int removed = arena.allocateZeros(sG.n);
+    int *data = arena.at(0);
+
+    for (int *v = data + list; v != data + list + size; v++)
+    {
+        data[removed + *v] = true;
+    }
+    subgraphUpdate(sG, removed, branch);
+}
+
+void VertexCover::takeAll(
+    flatGraph &sG,
+    int list,
+    int size)
+{
+    int *data = arena.at(0);
+
+    for (int *v = data + list; v != data + list + size; v++)
+    {
+        take(data[sG.names + *v]);
+    }
+}
+
+void VertexCover::coverFound(
+    const std::vector<int> &remaining)
+{
+    cover = remaining;
+
+    for (std::vector<coverStep>::reverse_iterator step = steps.rbegin(); step != steps.rend(); step++)
+    {
+        if (step->a == -1)
+        {
+            cover.push_back(step->v);
+            continue;
+        }
+
+        /**
+         * Undoes a folding: v represents a and b in the folded graph.
+         */
+        std::vector<int>::iterator v = std::find(cover.begin(), cover.end(), step->v);
+
+        if (v != cover.end())
+        {
+            *v = step->a;
+            cover.push_back(step->b);
+        }
+        else
+        {
+            cover.push_back(step->v);
+        }
+    }
+}
+
+void VertexCover::publish(
+    flatGraph &G,
+    int k)
+{
+    vcTask task;
+    task.n = G.n;
+    task.k = k;
+    task.root = root;
+    task.steps = steps;
+    task.vertices = std::vector<vertex>(G.n);
+    task.adjLists = std::vector<std::vector<int> >(G.n);
+    int *data = arena.at(0);
+
+    for (int i = 0; i < G.n; i++)
+    {
+        int *row = data + data[G.begins + i];
+        task.vertices[i].v = data[G.names + i];
+        task.vertices[i].degree = data[G.degrees + i];
+        task.vertices[i].pos = i;
+        task.adjLists[i].assign(row, row + data[G.degrees + i]);
+    }
+    numPublished++;
+    scheduler->push(worker, std::move(task));
+}
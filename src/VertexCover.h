@@ -0,0 +1,484 @@
+/**@file VertexCover.h
+ *
+ * @brief Finds if a graph has a vertex cover of size k.
+ *
+ * @details The procedure performs the following tasks until there is no further
+ * update:
+ *
+ * 1. Any isolated vertex is removed.
+ * 2. If there is a vertex v with degree 1, both v and its neighbor are removed
+ *    and k is decreased by 1.
+ * 3. If there is a graph v with degree 2:
+ *    a. If its neighbors u and w are adjacent, u, v, and w are removed and k is
+ *    decreased by 2.
+ *    b. If its neighbors u and w are not adjacent, u and w are removed and its
+ *    neighbors are attatched to v (vertex folding). k is decreased by 1.
+ * 4. Optionally, the twin, domination and unconfined rules (@see
+ *    VertexCover::degreePreprocessing).
+ *
+ * A greedy clique cover gives a lower bound of the vertex cover, and the node
+ * is pruned if it is larger than k. Otherwise, the vertex v with the largest
+ * degree is selected. The procedure generates one branch in which v is assumed
+ * to be in the vertex cover. That is, v is removed and k is decreased by 1. A
+ * second branch is created assuming the vertices in N(v) in the vertex cover.
+ * That is, N[v] are removed and k is decreased by |N(v)|. Optionally, the
+ * branches are extended with the mirrors or, if v has none, the satellites of
+ * v (@see VertexCover::branchSets).
+ *
+ * The nodes whose graph and k are small enough are solved by SmallVertexCover
+ * instead of the rules above (@see VertexCover::solveSmall).
+ *
+ * The graphs of the recursion are stored in the arena of the solver
+ * (@see Arena), with the adjacency lists appended one after the other
+ * (@see flatGraph), so the nodes do not allocate memory from the heap.
+ *
+ * If the procedure runs under a Scheduler and some workers are idle, the second
+ * branch is published as a task (@see Scheduler) instead of being explored by
+ * the current thread.
+ *
+ * If the cancellation token is set (i.e., another thread already found a vertex
+ * cover), the procedures stop as soon as possible and report that there is no
+ * vertex cover.
+ *
+ * @author Jose L. Walteros
+ *
+ * @version   1.0
+ * @date      January 2018
+ *
+ * Copyright (C) 2018 Jose L. Walteros. All rights reserved.
+ *
+ *---+----+----+----+----+----+----+----+----+----+----+----+----+----+----+----*/
+#ifndef _VERTEXCOVER_H_
+#define _VERTEXCOVER_H_
+
+#include <vector>
+#include <atomic>
+#include "Graph.h"
+#include "Scheduler.h"
+#include "Arena.h"
+#include "SmallVertexCover.h"
+#include "SearchStats.h"
+
+/**
+ * Graph of a node of the recursion, stored in the arena of the solver. The
+ * adjacency list of vertex i is the range [begins[i], begins[i] + degrees[i])
+ * of the arena, sorted by position.
+ */
+struct flatGraph
+{
+    int n; /**< Number of vertices */
+    int m; /**< Number of edges */
+    int names; /**< Offset of the names of the vertices */
+    int degrees; /**< Offset of the degrees of the vertices */
+    int begins; /**< Offset of the offsets of the adjacency lists */
+    int largestDegreeVertex; /**< Position of the vertex with the largest degree */
+};
+
+class VertexCover
+{
+public:
+    static const int maxMirrorCheck = 8; /**< Largest N(a) \ N(u) checked for
+    * being a clique when the mirrors of a are looked for */
+    Arena arena; /**< Storage of the graphs of the recursion */
+    Scheduler *scheduler = nullptr; /**< Scheduler that receives the published
+    * branches (none if the recursion runs on a single thread) */
+    int worker = 0; /**< Worker of the scheduler that runs the recursion */
+    static const int nodeBatch = 1024; /**< Search nodes a solver explores
+    * between two updates of the shared node counter */
+    const std::atomic<bool> *cancel = nullptr; /**< Cancellation token (may be null) */
+    long long numNodes = 0; /**< Search nodes explored by kVertexCover */
+    std::atomic<long long> *sharedNodes = nullptr; /**< Node counter shared by
+    * the solvers of a run, which receives the nodes of this one every nodeBatch
+    * nodes (none if null) */
+    long long numPruned = 0; /**< Nodes pruned by the lower bound */
+    bool smallSolver = true; /**< Whether the small nodes are solved by
+    * SmallVertexCover */
+    long long numSmall = 0; /**< Nodes solved by SmallVertexCover */
+    long long smallNodes = 0; /**< Nodes of the recursions of SmallVertexCover */
+    std::vector<uint64_t> smallRows; /**< Adjacency matrix of the graph given to
+    * VertexCover::solveSmall */
+    std::vector<int> smallCover; /**< Cover found by SmallVertexCover */
+    int depth = 0; /**< Depth of the current node in the recursion */
+    workerStats *stats = nullptr; /**< Statistics of the worker that runs the
+    * solver, which get the nodes and the time of every depth (only if
+    * statsEnabled, @see SearchStats.h) */
+    double kernelTime = 0; /**< Seconds spent in the Buss and NT kernels of the
+    * subgraphs (@see Clique::processLists) */
+    double searchTime = 0; /**< Seconds spent in the vertex cover search of the
+    * kernels and the published branches */
+    long long wastedNodes = 0; /**< Search nodes explored in subproblems that
+    * were abandoned because of the cancellation token */
+    int numCancelled = 0; /**< Subproblems abandoned because of the cancellation
+    * token */
+    long long numCoreFiltered = 0; /**< Subgraphs of the worker discarded by the
+    * core number (@see Clique::filterVertex) */
+    long long numColorFiltered = 0; /**< Subgraphs of the worker discarded by the
+    * coloring */
+    long long numKnownInfeasible = 0; /**< Subgraphs of the worker skipped
+    * because they had no vertex cover for a larger k */
+    long long numPublished = 0; /**< Branches published as tasks of the scheduler */
+    int root = -1; /**< Vertex whose subgraph is being solved */
+    std::vector<coverStep> steps; /**< Decisions taken from the subgraph of root
+    * to the current node: the vertices put in the cover by the kernels, the
+    * reductions and the branching, and the vertex foldings */
+    std::vector<int> cover; /**< Names of the vertices of the last vertex cover
+    * found, in the subgraph of root */
+
+    /**
+     * Reduction rules of VertexCover::degreePreprocessing and branching rules
+     * of VertexCover::branchSets. The degree rules (the first four) are always
+     * applied.
+     */
+    enum reduction
+    {
+        highDegreeRule, /**< A vertex of degree > k is in the vertex cover */
+        degreeOneRule, /**< The neighbor of a vertex of degree 1 is in the
+        * vertex cover */
+        triangleRule, /**< The neighbors of a vertex of degree 2 that are
+        * adjacent are in the vertex cover */
+        foldRule, /**< A vertex of degree 2 is folded with its neighbors */
+        twinRule, /**< Two vertices of degree 3 with the same neighbors, between
+        * which there is an edge, leave the neighbors in the vertex cover */
+        dominationRule, /**< A vertex v such that N[u] is contained in N[v] for
+        * a neighbor u is in the vertex cover */
+        unconfinedRule, /**< An unconfined vertex is in the vertex cover */
+        mirrorRule, /**< The upper branch also takes the mirrors of the vertex */
+        satelliteRule, /**< The lower branch also takes the neighbors of the
+        * satellites of the vertex */
+        numReductions
+    };
+
+    static const unsigned allReductions = (1u << twinRule) | (1u << dominationRule) | (1u << unconfinedRule) |
+        (1u << mirrorRule) | (1u << satelliteRule); /**<
+    * Mask of the optional rules */
+    static const unsigned defaultReductions = 1u << twinRule; /**< Optional rules
+    * applied by default. The others look at every edge of the nodes, so they
+    * only pay off when they shorten the recursion */
+    unsigned reductions = defaultReductions; /**< Rules applied besides the degree
+    * rules, as a mask of (1 << rule) */
+    long long numReduced[numReductions] = {}; /**< Times every rule was applied */
+
+    /**
+     * Default constructor.
+     */
+    inline VertexCover() {}
+
+    /**
+     * VertexCover constructor: the recursion runs as a worker of a scheduler.
+     *
+     * @param[in] scheduler : Scheduler that receives the published branches.
+     * @param[in] worker : Worker that runs the recursion.
+     */
+    inline VertexCover(
+        Scheduler *scheduler,
+        int worker)
+    {
+        this->scheduler = scheduler;
+        this->worker = worker;
+    }
+
+    /**
+     * Whether the cancellation token has been set.
+     */
+    inline bool cancelled() const
+    {
+        return (cancel != nullptr) && cancel->load(std::memory_order_relaxed);
+    }
+
+    /**
+     * Counts a search node.
+     */
+    inline void countNode()
+    {
+        if ((++numNodes % nodeBatch == 0) && (sharedNodes != nullptr))
+        {
+            sharedNodes->fetch_add(nodeBatch, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * Records that v is in the vertex cover.
+     */
+    inline void take(
+        int v)
+    {
+        steps.push_back({v, -1, -1});
+    }
+
+    /**
+     * Records the folding of v with its neighbors a and b.
+     */
+    inline void recordFold(
+        int v,
+        int a,
+        int b)
+    {
+        steps.push_back({v, a, b});
+    }
+
+    /**
+     * Called when the graph of a node has a trivial vertex cover: rebuilds the
+     * cover of the subgraph of root from the vertices in remaining and the
+     * steps, which are undone from the last to the first.
+     *
+     * @param[in] remaining : Names of the vertices in the cover of the node.
+     */
+    void coverFound(
+        const std::vector<int> &remaining);
+
+    /**
+     * Whether a node with n vertices and a vertex cover of size k is solved by
+     * VertexCover::solveSmall.
+     */
+    inline bool isSmall(
+        int n,
+        int k) const
+    {
+        return smallSolver && SmallVertexCover::fits(n, k);
+    }
+
+    /**
+     * Solves a small node (@see VertexCover::isSmall) with SmallVertexCover.
+     * If there is a vertex cover, it is reported to VertexCover::coverFound.
+     *
+     * @param[in] n : Number of vertices of the node.
+     * @param[in] k : Expected size of the vertex cover.
+     * @param[in] names : Names of the vertices.
+     * @param[in] rows : Adjacency matrix of the node, filled by fill(rows, words)
+     * with words = (n + 63) / 64 words per vertex.
+     */
+    template <typename Fill>
+    inline bool solveSmall(
+        int n,
+        int k,
+        const int *names,
+        Fill fill)
+    {
+        int words = (n + 63) >> 6;
+        smallRows.assign((size_t)n * words, 0);
+        fill(smallRows.data(), words);
+        numSmall++;
+
+        if (!SmallVertexCover::solve(smallRows.data(), n, k, smallCover, smallNodes))
+        {
+            return false;
+        }
+        std::vector<int> remaining(smallCover.size());
+
+        for (size_t i = 0; i < smallCover.size(); i++)
+        {
+            remaining[i] = names[smallCover[i]];
+        }
+        coverFound(remaining);
+        return true;
+    }
+
+    /**
+     * DegreePreprocessing: The procedure performs the following tasks until
+     * there is no further update:
+     *
+     * 1. Any isolated vertex is removed.
+     * 2. If there is a vertex v with degree 1, both v and its neighbor are
+     * removed and k is decreased by 1.
+     * 3. If there is a graph v with degree 2:
+     *    a. If its neighbors u and w are adjacent, u, v, and w are removed and
+     *       k is decreased by 2.
+     *    b. If its neighbors u and w are not adjacent, u and w are removed and
+     *       its neighbors are attatched to v (vertex folding). k is decreased by 1.
+     *
+     * If they are selected in VertexCover::reductions, the procedure also
+     * applies the following rules to the vertices v of degree at least 3:
+     *
+     * 4. Twin: if v has degree 3, there is another vertex with the same
+     *    neighbors and two of the neighbors are adjacent, the three neighbors
+     *    are removed and k is decreased by 3.
+     * 5. Domination: if N[u] is contained in N[v] for a neighbor u of v, v is
+     *    removed and k is decreased by 1.
+     * 6. Unconfined: if v is unconfined (Xiao and Nagamochi (2013)), v is
+     *    removed and k is decreased by 1. A vertex v that dominates a neighbor
+     *    u (N[u] contained in N[v]) is unconfined, so this rule finds more
+     *    vertices than the previous one at a higher cost.
+     *
+     * Rather than scanning all the vertices until there is no update, the
+     * procedure keeps a worklist with the vertices whose neighborhood changed,
+     * which starts with all of them. When it is empty, the vertices of degree
+     * larger than the current k join it, if k has decreased since the last
+     * time they were looked for.
+     *
+     * The adjacency lists of G are modified by the vertex foldings. The new
+     * list of v is allocated in the arena, while the neighbors of v replace u
+     * or w by v in their own lists.
+     *
+     * @param[in] G : The graph.
+     * @param[in] k : Expected size of the vertex cover.
+     * @param[out] newK : new value of k after the update.
+     * @param[out] kernel : the graph after the procedure.
+     */
+    int degreePreprocessing(
+        flatGraph &G,
+        int k,
+        int &newK,
+        flatGraph &kernel);
+
+    /**
+     * Name of a reduction rule.
+     */
+    static const char *reductionName(
+        int rule);
+
+    /**
+     * Reads a comma separated list of the optional rules ("twin", "domination",
+     * "unconfined", "mirror" and "satellite"), or "none" or "all".
+     *
+     * @param[in] names : The list.
+     * @param[out] mask : The rules, as VertexCover::reductions.
+     *
+     * @returns false if a name is not known.
+     */
+    static bool parseReductions(
+        const char *names,
+        unsigned &mask);
+
+    /**
+     * Given a set of vertices that are marked as removed, produces the
+     * corresponding
+     * updated subgraph.
+     *
+     * @param[in] n : Number of vertices in the original graph.
+     * @param[in] numRemoved : Number of vertices that are marked as removed.
+     * @param[in] vertices : vertices of the graph.
+     * @param[in] adjLists : Adjacency lists of the graphs.
+     * @param[in] removed : if the vertices are removed or not.
+     * @param[out] kernel : the graph after the procedure.
+     */
+    void subgraphUpdate(
+        int n,
+        int &numRemoved,
+        std::vector<vertex> &vertices,
+        std::vector<std::vector<int> > &adjLists,
+        std::vector<bool> &removed,
+        subgraph &kernel);
+
+    /**
+     * Version of subgraphUpdate for the graphs of the recursion: the updated
+     * subgraph is allocated in the arena.
+     *
+     * @param[in] G : The graph.
+     * @param[in] removed : Offset of the flags (one per vertex of G) that mark
+     * the removed vertices.
+     * @param[out] kernel : the graph after the procedure.
+     */
+    void subgraphUpdate(
+        flatGraph &G,
+        int removed,
+        flatGraph &kernel);
+
+    /**
+     * kVertexCover:
+     *
+     * Finds if a graph has a vertex cover of size k.
+     *
+     * a) Calls the degree reduction procedure (@see
+     * VertexCover::degreePreprocessing)
+     *
+     * b) Generates two branches using the vertex with the largest degree k. The
+     * first branch
+     * is created by adding k the vertex cover reducing k and the size of G by
+     * one.
+     * The othe branch is created by adding all the neighbors of k reducing k by
+     *\Delta(G') and
+     * G' by \Delta(G')+1
+     *
+     * The graph is copied to the arena and solved by VertexCover::search.
+     *
+     * @param[in] n : Number of vertices in the graph.
+     * @param[in] k : Expected size of the vertex cover.
+     * @param[in] vertices : vertices of the graph.
+     * @param[in] adjLists : Adjacency lists of the graphs.
+     */
+    bool kVertexCover(
+        int n,
+        int k,
+        std::vector<vertex> &vertices,
+        std::vector<std::vector<int> > &adjLists);
+
+    /**
+     * Node of the recursion of kVertexCover. Everything the node allocates in
+     * the arena is released when it returns.
+     *
+     * @param[in] G : The graph (its lists are modified).
+     * @param[in] k : Expected size of the vertex cover.
+     */
+    bool search(
+        flatGraph &G,
+        int k);
+
+    /**
+     * Lower bound of the size of a vertex cover of G: a greedy clique cover of
+     * G, in which every clique C needs |C| - 1 vertices of the cover.
+     */
+    int lowerBound(
+        flatGraph &G);
+
+    /**
+     * Vertices of the branches on a. If they are selected in
+     * VertexCover::reductions, the mirrors and satellites of a are added to
+     * them. The mirrors of a are the vertices u at
+     * distance 2 from a such that N(a) \ N(u) is a clique: if a is in the
+     * vertex cover, so are its mirrors (or there is one with N(a) instead).
+     * If a has no mirrors, its satellites are the vertices s such that
+     * N(u) \ N[a] = {s} for a neighbor u of a: if a is not in the vertex cover,
+     * there is one that has neither a nor its satellites, so it has their
+     * neighbors.
+     *
+     * @param[in] G : Graph of the node.
+     * @param[in] a : Vertex used for branching.
+     * @param[in] upper : Offset of an array of G.n ints that receives a and its
+     * mirrors (the cover of the upper branch).
+     * @param[out] numUpper : Number of vertices of the upper branch.
+     * @param[in] lower : Offset of an array of G.n ints that receives the
+     * cover of the lower branch, followed by the other vertices it removes.
+     * @param[out] numLowerCover : Size of the cover of the lower branch.
+     * @param[out] numLower : Number of vertices removed by the lower branch.
+     */
+    void branchSets(
+        flatGraph &G,
+        int a,
+        int upper,
+        int &numUpper,
+        int lower,
+        int &numLowerCover,
+        int &numLower);
+
+    /**
+     * Generates the graph of a branch of kVertexCover, in which the vertices
+     * of the list are removed.
+     *
+     * @param[in] sG : Graph of the node.
+     * @param[in] list : Offset of the vertices removed.
+     * @param[in] size : Number of vertices removed.
+     * @param[out] branch : the resulting graph.
+     */
+    void branchGraph(
+        flatGraph &sG,
+        int list,
+        int size,
+        flatGraph &branch);
+
+    /**
+     * Records that the vertices of the list are in the vertex cover.
+     */
+    void takeAll(
+        flatGraph &sG,
+        int list,
+        int size);
+
+    /**
+     * Publishes a graph of the arena as a task of the scheduler, together with
+     * the current steps.
+     */
+    void publish(
+        flatGraph &G,
+        int k);
+};
+#endif // _VERTEXCOVER_H_
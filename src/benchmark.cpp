@@ -0,0 +1,500 @@
+/**
+ * @file benchmark.cpp
+ *
+ * @brief Benchmark of the maximum clique search over a fixed set of graphs.
+ *
+ * @details Every graph (read from a file or generated in memory) is solved
+ * several times with each number of threads. The median and the 95th
+ * percentile of the reading, degeneracy, kernel, vertex cover search (FPT)
+ * and total times are written as JSON, one result per line. Given a baseline
+ * written by a previous run, the benchmark fails if the median of a time
+ * grew by more than the threshold, or if a clique size changed.
+ *
+ * @author Jose L. Walteros
+ *
+ * @version   1.0
+ * @date      June 2018
+ *
+ * Copyright (C) 2018 Jose L. Walteros. All rights reserved.
+ *
+ *---+----+----+----+----+----+----+----+----+----+----+----+----+----+----+----*/
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "CliqueSolver.h"
+#include "Graph.h"
+
+/**
+ * Times measured in every run, in the order of the JSON output.
+ */
+static const int numMetrics = 7;
+static const char *metricNames[numMetrics] = {"read", "degeneracy", "heuristic", "kernel", "fpt", "solve", "total"};
+
+/**
+ * Times compared with the baseline.
+ */
+static const bool compared[numMetrics] = {true, true, false, true, true, false, true};
+
+/**
+ * Statistics of the runs of a graph with a number of threads.
+ */
+struct benchmarkResult
+{
+    std::string instance; /**< Name of the graph */
+    int threads; /**< Number of threads */
+    int n; /**< Number of vertices */
+    int m; /**< Number of edges */
+    int omega; /**< Size of the maximum clique (-1 if the runs disagree) */
+    double median[numMetrics]; /**< Median of every time */
+    double p95[numMetrics]; /**< 95th percentile of every time */
+};
+
+/**
+ * Splits a comma separated list.
+ */
+static std::vector<std::string> splitList(
+    const char *list)
+{
+    std::vector<std::string> items;
+    std::stringstream ss(list);
+    std::string item;
+
+    while (std::getline(ss, item, ','))
+    {
+        if (!item.empty())
+        {
+            items.push_back(item);
+        }
+    }
+    return items;
+}
+
+/**
+ * Parses a comma separated list of positive integers.
+ *
+ * @returns false if an item is not one.
+ */
+static bool parseIntegers(
+    const char *list,
+    std::vector<int> &values)
+{
+    values.clear();
+
+    for (const std::string &item : splitList(list))
+    {
+        char *pconv;
+        long value = strtol(item.c_str(), &pconv, 10);
+
+        if ((*pconv != '\0') || (value <= 0) || (value > INT32_MAX))
+        {
+            return false;
+        }
+        values.push_back(value);
+    }
+    return true;
+}
+
+/**
+ * Random graph with n vertices and 4n edges plus a planted clique of 12
+ * vertices. The raw output of std::mt19937 with a fixed seed is used, so the
+ * graph is the same on every platform.
+ */
+static void generateEdges(
+    int n,
+    std::vector<int> &tails,
+    std::vector<int> &heads)
+{
+    const int cliqueSize = 12;
+    std::mt19937 random(n);
+    tails.clear();
+    heads.clear();
+
+    for (long long e = 0; e < 4LL * n; e++)
+    {
+        tails.push_back(random() % n);
+        heads.push_back(random() % n);
+    }
+    std::vector<int> clique;
+
+    while ((int)clique.size() < std::min(cliqueSize, n))
+    {
+        int v = random() % n;
+
+        if (std::find(clique.begin(), clique.end(), v) == clique.end())
+        {
+            clique.push_back(v);
+        }
+    }
+
+    for (size_t i = 0; i < clique.size(); i++)
+    {
+        for (size_t j = i + 1; j < clique.size(); j++)
+        {
+            tails.push_back(clique[i]);
+            heads.push_back(clique[j]);
+        }
+    }
+}
+
+/**
+ * Value of the p-th percentile (nearest rank) of the samples.
+ */
+static double percentile(
+    std::vector<double> samples,
+    double p)
+{
+    std::sort(samples.begin(), samples.end());
+    int rank = std::max((int)std::ceil(p * samples.size()), 1);
+    return samples[rank - 1];
+}
+
+/**
+ * Median of the samples.
+ */
+static double median(
+    std::vector<double> samples)
+{
+    std::sort(samples.begin(), samples.end());
+    size_t half = samples.size() / 2;
+    return (samples.size() % 2 == 1) ? samples[half] : (samples[half - 1] + samples[half]) / 2;
+}
+
+/**
+ * Writes a result as a single line JSON object.
+ */
+static void writeResult(
+    std::ostream &out,
+    const benchmarkResult &result)
+{
+    out << "{\"instance\": \"" << result.instance << "\", \"threads\": " << result.threads <<
+    ", \"n\": " << result.n << ", \"m\": " << result.m << ", \"omega\": " << result.omega;
+
+    for (int s = 0; s < 2; s++)
+    {
+        const double *values = (s == 0) ? result.median : result.p95;
+        out << ", \"" << ((s == 0) ? "median" : "p95") << "\": {";
+
+        for (int metric = 0; metric < numMetrics; metric++)
+        {
+            out << (metric > 0 ? ", " : "") << "\"" << metricNames[metric] << "\": " << values[metric];
+        }
+        out << "}";
+    }
+    out << "}";
+}
+
+/**
+ * Finds the number that follows "key": in line, after position from.
+ *
+ * @returns false if there is none.
+ */
+static bool findNumber(
+    const std::string &line,
+    const std::string &key,
+    size_t from,
+    double &value)
+{
+    size_t position = line.find("\"" + key + "\":", from);
+
+    if (position == std::string::npos)
+    {
+        return false;
+    }
+    const char *begin = line.c_str() + position + key.size() + 3;
+    char *pconv;
+    value = strtod(begin, &pconv);
+    return pconv != begin;
+}
+
+/**
+ * Reads the results of a file written by the benchmark (one result per line;
+ * the percentiles are not needed).
+ *
+ * @returns false if the file cannot be read.
+ */
+static bool readBaseline(
+    const char *filename,
+    std::vector<benchmarkResult> &results)
+{
+    std::ifstream file(filename);
+
+    if (!file)
+    {
+        return false;
+    }
+    std::string line;
+
+    while (std::getline(file, line))
+    {
+        size_t begin = line.find("{\"instance\": \"");
+
+        if (begin == std::string::npos)
+        {
+            continue;
+        }
+        begin += 14;
+        size_t end = line.find('"', begin);
+        size_t medianBegin = line.find("\"median\":");
+        benchmarkResult result;
+        double threads;
+        double omega;
+        bool valid = (end != std::string::npos) && (medianBegin != std::string::npos) &&
+                     findNumber(line, "threads", 0, threads) && findNumber(line, "omega", 0, omega);
+
+        for (int metric = 0; valid && (metric < numMetrics); metric++)
+        {
+            valid = findNumber(line, metricNames[metric], medianBegin, result.median[metric]);
+        }
+
+        if (!valid)
+        {
+            return false;
+        }
+        result.instance = line.substr(begin, end - begin);
+        result.threads = threads;
+        result.omega = omega;
+        results.push_back(result);
+    }
+    return true;
+}
+
+int main(int argc, const char *argv[])
+{
+    std::vector<std::string> instances;
+    std::vector<int> generated;
+    std::vector<int> threadCounts(1, 1);
+    const char *type = "-pe";
+    const char *baselineFile = nullptr;
+    const char *outputFile = nullptr;
+    int repeats = 5;
+    double threshold = 0.25;
+    double minIncrease = 0.01;
+    double heuristicBudget = 1.0;
+    bool options = true;
+
+    /**
+     * The options are given as --name=value.
+     */
+    for (int i = 1; i < argc; i++)
+    {
+        char *pconv = nullptr;
+
+        if (strncmp(argv[i], "--instances=", 12) == 0)
+        {
+            instances = splitList(argv[i] + 12);
+        }
+        else if (strncmp(argv[i], "--generated=", 12) == 0)
+        {
+            generated.clear();
+
+            if (strcmp(argv[i] + 12, "none") != 0)
+            {
+                options = options && parseIntegers(argv[i] + 12, generated);
+            }
+        }
+        else if (strncmp(argv[i], "--threads=", 10) == 0)
+        {
+            options = options && parseIntegers(argv[i] + 10, threadCounts) && !threadCounts.empty();
+        }
+        else if (strncmp(argv[i], "--type=", 7) == 0)
+        {
+            type = argv[i] + 7;
+        }
+        else if (strncmp(argv[i], "--repeats=", 10) == 0)
+        {
+            repeats = strtol(argv[i] + 10, &pconv, 10);
+            options = options && (*pconv == '\0') && (repeats > 0);
+        }
+        else if (strncmp(argv[i], "--threshold=", 12) == 0)
+        {
+            threshold = strtod(argv[i] + 12, &pconv);
+            options = options && (*pconv == '\0') && (threshold >= 0);
+        }
+        else if (strncmp(argv[i], "--floor=", 8) == 0)
+        {
+            minIncrease = strtod(argv[i] + 8, &pconv);
+            options = options && (*pconv == '\0') && (minIncrease >= 0);
+        }
+        else if (strncmp(argv[i], "--heuristic=", 12) == 0)
+        {
+            heuristicBudget = strtod(argv[i] + 12, &pconv);
+            options = options && (*pconv == '\0') && (heuristicBudget >= 0);
+        }
+        else if (strncmp(argv[i], "--baseline=", 11) == 0)
+        {
+            baselineFile = argv[i] + 11;
+        }
+        else if (strncmp(argv[i], "--output=", 9) == 0)
+        {
+            outputFile = argv[i] + 9;
+        }
+        else
+        {
+            options = false;
+        }
+    }
+
+    if (!options || (instances.empty() && generated.empty()))
+    {
+        std::cout << "Incorrect inputs. See the README file\n";
+        return 2;
+    }
+
+    std::vector<benchmarkResult> baseline;
+
+    if ((baselineFile != nullptr) && !readBaseline(baselineFile, baseline))
+    {
+        std::cerr << "ERROR: could not read the baseline '" << baselineFile << "'\n";
+        return 2;
+    }
+
+    /**
+     * The generated graphs follow the files, named after their size.
+     */
+    std::vector<std::string> names(instances);
+
+    for (int size : generated)
+    {
+        names.push_back("generated-" + std::to_string(size));
+    }
+
+    std::vector<benchmarkResult> results;
+    std::vector<int> tails;
+    std::vector<int> heads;
+
+    for (int threads : threadCounts)
+    {
+        CliqueSolver solver(threads);
+        solver.configure = [heuristicBudget](Clique &clique) { clique.heuristicBudget = heuristicBudget; };
+
+        for (size_t g = 0; g < names.size(); g++)
+        {
+            benchmarkResult result;
+            result.instance = names[g].substr(names[g].find_last_of('/') + 1);
+            result.threads = threads;
+            result.omega = 0;
+            std::vector<std::vector<double> > samples(numMetrics);
+
+            if (g >= instances.size())
+            {
+                generateEdges(generated[g - instances.size()], tails, heads);
+            }
+
+            /**
+             * The first run warms up the page cache and the context, and is
+             * not measured.
+             */
+            for (int run = -1; run < repeats; run++)
+            {
+                bool read = true;
+                std::unique_ptr<Graph> graph(g < instances.size() ?
+                                             new Graph(type, names[g].c_str(), read, threads) :
+                                             new Graph(generated[g - instances.size()], tails.data(), heads.data(), tails.size(), read, threads));
+
+                if (!read)
+                {
+                    std::cerr << "ERROR: could not read '" << names[g] << "'\n";
+                    return 2;
+                }
+                cliqueResult r = solver.solve(*graph);
+                double times[numMetrics] = {graph->readTime.count(), r.degeneracyTime.count(), r.heuristicTime.count(),
+                                            r.kernelTime.count(), r.searchTime.count(), r.runningTime.count(),
+                                            graph->readTime.count() + r.runningTime.count()};
+                result.n = graph->n;
+                result.m = graph->m;
+                result.omega = ((run < 0) || (result.omega == r.omega)) ? r.omega : -1;
+
+                for (int metric = 0; (run >= 0) && (metric < numMetrics); metric++)
+                {
+                    samples[metric].push_back(times[metric]);
+                }
+            }
+
+            for (int metric = 0; metric < numMetrics; metric++)
+            {
+                result.median[metric] = median(samples[metric]);
+                result.p95[metric] = percentile(samples[metric], 0.95);
+            }
+            results.push_back(result);
+            std::clog << std::left << std::setw(28) << result.instance << " threads " << std::setw(3) << threads <<
+            " omega " << std::setw(4) << result.omega << " total " << result.median[numMetrics - 1] <<
+            " (p95 " << result.p95[numMetrics - 1] << ")\n";
+        }
+    }
+
+    std::ofstream file;
+
+    if (outputFile != nullptr)
+    {
+        file.open(outputFile);
+
+        if (!file)
+        {
+            std::cerr << "ERROR: could not open file '" << outputFile << "' for writing\n";
+            return 2;
+        }
+    }
+    std::ostream &out = (outputFile != nullptr) ? file : std::cout;
+    out << "{\"repeats\": " << repeats << ", \"results\": [\n";
+
+    for (size_t i = 0; i < results.size(); i++)
+    {
+        writeResult(out, results[i]);
+        out << ((i + 1 < results.size()) ? ",\n" : "\n");
+    }
+    out << "]}\n";
+
+    /**
+     * A time regresses if its median grew by more than the threshold and by
+     * more than the floor (in seconds), which keeps the noise of the short
+     * times from failing the comparison.
+     */
+    int numRegressions = 0;
+
+    for (const benchmarkResult &result : results)
+    {
+        std::vector<benchmarkResult>::iterator base = std::find_if(baseline.begin(), baseline.end(),
+            [&result](const benchmarkResult &b) { return (b.instance == result.instance) && (b.threads == result.threads); });
+
+        if (base == baseline.end())
+        {
+            continue;
+        }
+
+        if (base->omega != result.omega)
+        {
+            std::clog << "REGRESSION: " << result.instance << " with " << result.threads << " threads: omega " <<
+            result.omega << " instead of " << base->omega << "\n";
+            numRegressions++;
+        }
+
+        for (int metric = 0; metric < numMetrics; metric++)
+        {
+            double before = base->median[metric];
+            double after = result.median[metric];
+
+            if (compared[metric] && (after > before * (1 + threshold)) && (after - before > minIncrease))
+            {
+                std::clog << "REGRESSION: " << result.instance << " with " << result.threads << " threads: " <<
+                metricNames[metric] << " " << after << " instead of " << before << "\n";
+                numRegressions++;
+            }
+        }
+    }
+
+    if (baselineFile != nullptr)
+    {
+        std::clog << numRegressions << " regressions against " << baselineFile << "\n";
+    }
+    return (numRegressions > 0) ? 1 : 0;
+}
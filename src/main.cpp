@@ -0,0 +1,495 @@
+/**
+ * @file main.h
+ *
+ * @brief Finds the maximum clique of a graph.
+ *
+ * @author Jose L. Walteros
+ *
+ * @version   1.0
+ * @date      June 2018
+ *
+ * Copyright (C) 2018 Jose L. Walteros. All rights reserved.
+ *
+ *---+----+----+----+----+----+----+----+----+----+----+----+----+----+----+----*/
+#include <string>
+#include <sstream>
+#include <cstring>
+#include <climits>
+#include <chrono>
+#include <thread>
+#include <iostream>
+#include <fstream>
+#include "Clique.h"
+#include "CliqueEnumerator.h"
+#include "DynamicClique.h"
+#include "Graph.h"
+#include "Snapshot.h"
+#include "SubgraphCache.h"
+#include "SearchStrategy.h"
+#include "BatchSolver.h"
+#include "Cluster.h"
+#ifdef DOMEGA_MPI
+#include "MpiCluster.h"
+#endif
+
+int main(int argc, const char *argv[])
+{
+    std::stringstream output;
+    int numThreads = std::thread::hardware_concurrency();
+
+    /**
+     * Built with make MPI=1 and started by mpirun with several processes,
+     * the processes share the maximum clique search (@see Cluster). Only rank
+     * 0 writes the results.
+     */
+    Cluster *cluster = nullptr;
+#ifdef DOMEGA_MPI
+    bool threaded = false;
+    MpiCluster mpi(threaded);
+
+    if (!threaded)
+    {
+        std::cerr << "ERROR: the MPI library does not support MPI_THREAD_SERIALIZED\n";
+        return 0;
+    }
+
+    if (mpi.size() > 1)
+    {
+        cluster = &mpi;
+    }
+#endif
+    bool leader = (cluster == nullptr) || (cluster->rank() == 0);
+
+    if (argc < 4)
+    {
+        std::cout << "Incorrect inputs. See the README file\n";
+    }
+    else
+    {
+        const char *type = argv[1];
+        const char *filename = argv[2];
+        const char *algorithm = argv[3];
+
+        const char *backend = "lists";
+        const char *branching = "copy";
+        const char *search = "linear";
+        const char *filter = "coloring";
+        const char *relabel = "off";
+        const char *small = "on";
+        const char *reductionList = nullptr;
+        unsigned reductions = VertexCover::defaultReductions;
+        SearchStrategy::kind strategy = SearchStrategy::linear;
+        const char *cliqueFile = nullptr;
+        const char *statsFile = nullptr;
+        const char *updatesFile = nullptr;
+        long long cacheBudget = SubgraphCache::defaultBudget >> 20;
+        long long streamBudget = Graph::defaultStreamBudget >> 20;
+        double heuristicBudget = 1.0;
+        long long top = 0;
+        double timeLimit = 0;
+        long long nodeLimit = 0;
+        const char *pin = "off";
+        bool options = true;
+
+        /**
+         * The arguments after the algorithm are the number of threads
+         * (or the output file) and the options, given as --name=value.
+         */
+        for (int i = 4; i < argc; i++)
+        {
+            if (strncmp(argv[i], "--backend=", 10) == 0)
+            {
+                backend = argv[i] + 10;
+            }
+            else if (strncmp(argv[i], "--branching=", 12) == 0)
+            {
+                branching = argv[i] + 12;
+            }
+            else if (strncmp(argv[i], "--filter=", 9) == 0)
+            {
+                filter = argv[i] + 9;
+            }
+            else if (strncmp(argv[i], "--relabel=", 10) == 0)
+            {
+                relabel = argv[i] + 10;
+            }
+            else if (strncmp(argv[i], "--small=", 8) == 0)
+            {
+                small = argv[i] + 8;
+            }
+            else if (strncmp(argv[i], "--reductions=", 13) == 0)
+            {
+                reductionList = argv[i] + 13;
+            }
+            else if (strncmp(argv[i], "--search=", 9) == 0)
+            {
+                search = argv[i] + 9;
+            }
+            else if (strncmp(argv[i], "--clique=", 9) == 0)
+            {
+                cliqueFile = argv[i] + 9;
+            }
+            else if (strncmp(argv[i], "--stats=", 8) == 0)
+            {
+                statsFile = argv[i] + 8;
+            }
+            else if (strncmp(argv[i], "--updates=", 10) == 0)
+            {
+                updatesFile = argv[i] + 10;
+            }
+            else if (strncmp(argv[i], "--cache=", 8) == 0)
+            {
+                char *pconv;
+                cacheBudget = strtoll(argv[i] + 8, &pconv, 10);
+
+                if ((pconv == argv[i] + 8) || (*pconv != '\0'))
+                {
+                    cacheBudget = -1;
+                }
+            }
+            else if (strncmp(argv[i], "--stream-budget=", 16) == 0)
+            {
+                char *pconv;
+                streamBudget = strtoll(argv[i] + 16, &pconv, 10);
+
+                if ((pconv == argv[i] + 16) || (*pconv != '\0') || (streamBudget > (LLONG_MAX >> 20)))
+                {
+                    streamBudget = -1;
+                }
+            }
+            else if (strncmp(argv[i], "--heuristic=", 12) == 0)
+            {
+                char *pconv;
+                heuristicBudget = strtod(argv[i] + 12, &pconv);
+
+                if ((pconv == argv[i] + 12) || (*pconv != '\0'))
+                {
+                    heuristicBudget = -1;
+                }
+            }
+            else if (strncmp(argv[i], "--time-limit=", 13) == 0)
+            {
+                char *pconv;
+                timeLimit = strtod(argv[i] + 13, &pconv);
+
+                if ((pconv == argv[i] + 13) || (*pconv != '\0'))
+                {
+                    timeLimit = -1;
+                }
+            }
+            else if (strncmp(argv[i], "--node-limit=", 13) == 0)
+            {
+                char *pconv;
+                nodeLimit = strtoll(argv[i] + 13, &pconv, 10);
+
+                if ((pconv == argv[i] + 13) || (*pconv != '\0'))
+                {
+                    nodeLimit = -1;
+                }
+            }
+            else if (strncmp(argv[i], "--pin=", 6) == 0)
+            {
+                pin = argv[i] + 6;
+            }
+            else if (strncmp(argv[i], "--top=", 6) == 0)
+            {
+                char *pconv;
+                top = strtoll(argv[i] + 6, &pconv, 10);
+
+                if ((pconv == argv[i] + 6) || (*pconv != '\0'))
+                {
+                    top = -1;
+                }
+            }
+            else if (strncmp(argv[i], "--", 2) == 0)
+            {
+                options = false;
+            }
+            else if (i == 4)
+            {
+                char *pconv;
+                int conv;
+                conv = strtol(argv[4], &pconv, 10);
+
+                if ((*pconv == '\0') && (conv <= numThreads))
+                {
+                    numThreads = conv;
+                }
+            }
+        }
+
+        if (!options || ((strcmp(backend, "lists") != 0) && (strcmp(backend, "bitset") != 0)) ||
+            ((strcmp(branching, "copy") != 0) && (strcmp(branching, "undo") != 0)) ||
+            ((strcmp(filter, "none") != 0) && (strcmp(filter, "core") != 0) && (strcmp(filter, "coloring") != 0)) ||
+            ((strcmp(relabel, "on") != 0) && (strcmp(relabel, "off") != 0)) ||
+            ((strcmp(small, "on") != 0) && (strcmp(small, "off") != 0)) ||
+            !SearchStrategy::parse(search, strategy) || ((reductionList != nullptr) && !VertexCover::parseReductions(reductionList, reductions)) ||
+            ((cliqueFile != nullptr) && (*cliqueFile == '\0')) || ((statsFile != nullptr) && (*statsFile == '\0')) ||
+            ((updatesFile != nullptr) && (*updatesFile == '\0')) || (cacheBudget < 0) ||
+            (streamBudget < 0) || !(heuristicBudget >= 0) || (top < 0) || !(timeLimit >= 0) || (nodeLimit < 0) ||
+            ((strcmp(pin, "on") != 0) && (strcmp(pin, "off") != 0)))
+        {
+            std::cout << "Incorrect inputs. See the README file\n";
+            return 0;
+        }
+
+        if ((cluster != nullptr) && (strcmp(algorithm, "-m") != 0))
+        {
+            if (leader)
+            {
+                std::cout << "Incorrect inputs. Only -m runs on several processes. See the README file\n";
+            }
+            return 0;
+        }
+
+        /**
+         * The budgets leave the clique number unknown, which the enumeration
+         * and the dynamic mode need, and they are not shared by processes.
+         */
+        bool budgeted = (timeLimit > 0) || (nodeLimit > 0);
+
+        if (budgeted && ((cluster != nullptr) || (strcmp(algorithm, "-me") == 0) || (strcmp(algorithm, "-md") == 0)))
+        {
+            if (leader)
+            {
+                std::cout << "Incorrect inputs. The budgets are only available for -m and -mb in a single process. See the README file\n";
+            }
+            return 0;
+        }
+
+        if ((statsFile != nullptr) && !statsEnabled)
+        {
+            std::cerr << "ERROR: the statistics are not collected (compile with make STATS=1)\n";
+            return 0;
+        }
+
+        /**
+         * Sets the options of the maximum clique search.
+         */
+        auto configure = [&](Clique &clique)
+        {
+            if (strcmp(backend, "bitset") == 0)
+            {
+                clique.backend = Clique::bitsetBackend;
+            }
+            clique.undoLog = (strcmp(branching, "undo") == 0);
+            clique.relabel = (strcmp(relabel, "on") == 0);
+            clique.smallSolver = (strcmp(small, "on") == 0);
+            clique.search = strategy;
+
+            if (strcmp(filter, "none") == 0)
+            {
+                clique.filter = Clique::noFilter;
+            }
+            else if (strcmp(filter, "core") == 0)
+            {
+                clique.filter = Clique::coreFilter;
+            }
+            clique.reductions = reductions;
+            clique.heuristicBudget = heuristicBudget;
+            clique.timeLimit = timeLimit;
+            clique.nodeLimit = nodeLimit;
+            clique.cache.budget = (size_t)cacheBudget << 20;
+            clique.cluster = cluster;
+
+            if (!leader)
+            {
+                clique.log = nullptr;
+            }
+
+            if ((strcmp(pin, "on") == 0) && !clique.pool.pin())
+            {
+                std::cerr << "Could not pin the workers to the processors\n";
+            }
+        };
+
+        /**
+         * Batch mode: filename is a manifest, a directory or "-" (the
+         * standard input), and every graph it names is solved. The vertices
+         * of the cliques can only be written to the standard output, and the
+         * workers of the graphs solved at the same time are not pinned.
+         */
+        if (strcmp(algorithm, "-mb") == 0)
+        {
+            if (((cliqueFile != nullptr) && (strcmp(cliqueFile, "-") != 0)) || (statsFile != nullptr) || (strcmp(pin, "on") == 0))
+            {
+                std::cout << "Incorrect inputs. See the README file\n";
+                return 0;
+            }
+            BatchSolver batch(type, numThreads, configure);
+            batch.printCliques = (cliqueFile != nullptr);
+            batch.run(filename);
+            return 0;
+        }
+
+        /**
+         * Dynamic mode: the batches of updates are read from the updates file
+         * ("-" is the standard input). The vertices of the cliques can only be
+         * written to the standard output.
+         */
+        if ((strcmp(algorithm, "-md") == 0) && ((updatesFile == nullptr) || (statsFile != nullptr) ||
+                                                ((cliqueFile != nullptr) && (strcmp(cliqueFile, "-") != 0))))
+        {
+            std::cout << "Incorrect inputs. See the README file\n";
+            return 0;
+        }
+
+        bool read = true;
+        Graph graph(type, filename, read, numThreads, streamBudget << 20);
+
+        if (read)
+        {
+            if (leader)
+            {
+                graph.printShort();
+            }
+
+            if (strcmp(algorithm, "-d") == 0)
+            {
+                graph.degeneracyOrdering();
+
+                output << filename << " " << graph.n << " " << graph.m << " " << graph.delta << " " << graph.Delta << " " << graph.readTime.count() << " " << graph.d << " " << graph.cliqueLB << "\n";
+
+                std::cout << output.str();
+            }
+
+            if ((strcmp(algorithm, "-w") == 0) || (strcmp(algorithm, "-wc") == 0))
+            {
+                /**
+                 * Writes a snapshot of the graph (-wc: only the CSR arrays;
+                 * -w: also the degeneracy ordering).
+                 */
+                if ((argc < 5) || (strncmp(argv[4], "--", 2) == 0))
+                {
+                    std::cout << "Incorrect inputs. See the README file\n";
+                }
+                else
+                {
+                    bool withOrdering = (strcmp(algorithm, "-w") == 0);
+
+                    if (withOrdering && !graph.ordered)
+                    {
+                        graph.computeDegeneracyOrdering();
+                    }
+
+                    if (Snapshot::write(graph, argv[4], withOrdering))
+                    {
+                        output << filename << " " << graph.n << " " << graph.m << " " << graph.delta << " " << graph.Delta << " " << graph.readTime.count();
+
+                        if (withOrdering)
+                        {
+                            output << " " << graph.d << " " << graph.cliqueLB << " " << graph.cliqueUB;
+                        }
+                        output << "\n";
+
+                        std::cout << output.str();
+                    }
+                }
+            }
+
+            if (strcmp(algorithm, "-m") == 0)
+            {
+                Clique clique(graph, numThreads);
+                configure(clique);
+                clique.findMaxClique();
+
+                if (!leader)
+                {
+                    return 0;
+                }
+                clique.printResult(std::cout);
+
+                if (statsFile != nullptr)
+                {
+                    std::ofstream file(statsFile);
+                    clique.writeStats(file);
+
+                    if (!file)
+                    {
+                        std::cerr << "Could not write the statistics to " << statsFile << "\n";
+                    }
+                }
+
+                /**
+                 * Writes the names of the vertices of the maximum clique in a
+                 * single line ("-" writes them to the standard output).
+                 */
+                if (cliqueFile != nullptr)
+                {
+                    std::stringstream line;
+                    clique.printClique(line);
+
+                    if (strcmp(cliqueFile, "-") == 0)
+                    {
+                        std::cout << line.str();
+                    }
+                    else
+                    {
+                        std::ofstream file(cliqueFile);
+
+                        if (!(file << line.str()))
+                        {
+                            std::cerr << "Could not write the clique to " << cliqueFile << "\n";
+                        }
+                    }
+                }
+            }
+
+            /**
+             * Keeps the maximum clique while the batches of updates are
+             * applied, and writes the result line of every batch after the
+             * one of the first search.
+             */
+            if (strcmp(algorithm, "-md") == 0)
+            {
+                Clique clique(graph, numThreads);
+                configure(clique);
+                clique.findMaxClique();
+                clique.printResult(std::cout);
+
+                if (cliqueFile != nullptr)
+                {
+                    clique.printClique(std::cout);
+                }
+                DynamicClique dynamic(clique);
+                dynamic.printCliques = (cliqueFile != nullptr);
+
+                if (!dynamic.run(updatesFile, std::cout))
+                {
+                    std::cerr << "Could not read the updates from " << updatesFile << "\n";
+                }
+            }
+
+            /**
+             * Enumerates the maximum cliques (--top=k: the k largest maximal
+             * cliques), which are written one per line after the summary
+             * line, or to the clique file.
+             */
+            if (strcmp(algorithm, "-me") == 0)
+            {
+                Clique clique(graph, numThreads);
+                configure(clique);
+                clique.findMaxClique();
+                CliqueEnumerator enumerator(clique);
+                enumerator.limit = top;
+                enumerator.run();
+                clique.printResult(std::cout);
+
+                if ((cliqueFile == nullptr) || (strcmp(cliqueFile, "-") == 0))
+                {
+                    enumerator.print(std::cout);
+                }
+                else
+                {
+                    std::ofstream file(cliqueFile);
+                    enumerator.print(file);
+
+                    if (!file)
+                    {
+                        std::cerr << "Could not write the cliques to " << cliqueFile << "\n";
+                    }
+                }
+            }
+        }
+    }
+}